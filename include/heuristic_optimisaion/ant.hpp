@@ -0,0 +1,53 @@
+/**
+ * @file ant.hpp
+ * @author Nguyen Quang <nqoptik@gmail.com>
+ * @brief The ant algorithm.
+ * @since 0.0.1
+ * 
+ * @copyright Copyright (c) 2016, Nguyen Quang, all rights reserved.
+ * 
+ */
+
+#ifndef ANT_HPP
+#define ANT_HPP
+
+#include <cfloat>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "heuristic_optimisaion/common.hpp"
+
+// A pheromone matrix of number_of_vertices rows on entry, e.g. one updated for
+// a changed instance, is used instead of the initial pheromone. On return it
+// holds the pheromone of the run.
+void ant(const int& number_of_vertices,
+         const int& number_of_ants,
+         const float& evaporation,
+         const std::vector<std::vector<int>>& vertices,
+         const int& width,
+         const int& height,
+         const int& border,
+         const std::vector<std::vector<float>>& cost_matrix,
+         const std::vector<int>& initial_tour,
+         std::vector<std::vector<float>>& pheromone,
+         const SolverOptions& options,
+         const bool& verbose,
+         std::vector<int>& tour,
+         float& cost);
+void initialise_ant_algorithm(const int& number_of_vertices,
+                              const float& initial_pheromone,
+                              const float& scale_factor,
+                              const std::vector<std::vector<float>>& cost_matrix,
+                              std::vector<std::vector<float>>& pheromone,
+                              std::vector<std::vector<float>>& heuristic_factors);
+
+void update_pheromone(const int& number_of_vertices,
+                      const std::vector<int>& path,
+                      const float& scale_factor,
+                      const std::vector<std::vector<float>>& cost_matrix,
+                      const float& evaporation,
+                      std::vector<std::vector<float>>& pheromone);
+
+#endif // ANT_HPP
@@ -0,0 +1,61 @@
+/**
+ * @file checkpoint.hpp
+ * @author Nguyen Quang <nqoptik@gmail.com>
+ * @brief Snapshots of solver states for resuming and warm-starting runs.
+ * @since 0.0.2
+ *
+ * @copyright Copyright (c) 2016, Nguyen Quang, all rights reserved.
+ *
+ */
+
+#ifndef CHECKPOINT_HPP
+#define CHECKPOINT_HPP
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+bool is_valid_tour(const int& number_of_vertices,
+                   const std::vector<int>& tour);
+void save_tour(const std::string& file_name,
+               const std::vector<int>& tour);
+bool load_tour(const std::string& file_name,
+               const int& number_of_vertices,
+               std::vector<int>& tour);
+
+// The random generator is reseeded on every save and the seed is stored in the
+// snapshot, so that a resumed run continues with the same random sequence.
+// Tours and pheromone are stored in the original numbering of the vertices,
+// which original_ids maps the current indices to, so that snapshots do not
+// depend on whether the vertices are renumbered.
+void save_genetic_state(const std::string& file_name,
+                        const std::vector<int>& original_ids,
+                        const int& generation,
+                        const std::vector<std::vector<int>>& population,
+                        const std::vector<float>& current_costs);
+bool load_genetic_state(const std::string& file_name,
+                        const std::vector<int>& original_ids,
+                        const int& number_of_vertices,
+                        int& generation,
+                        std::vector<std::vector<int>>& population,
+                        std::vector<float>& current_costs);
+void save_ant_state(const std::string& file_name,
+                    const std::vector<int>& original_ids,
+                    const int& ant,
+                    const int& stop_count,
+                    const std::vector<std::vector<float>>& pheromone,
+                    const std::vector<int>& tour,
+                    const float& cost);
+bool load_ant_state(const std::string& file_name,
+                    const std::vector<int>& original_ids,
+                    const int& number_of_vertices,
+                    int& ant,
+                    int& stop_count,
+                    std::vector<std::vector<float>>& pheromone,
+                    std::vector<int>& tour,
+                    float& cost);
+
+#endif // CHECKPOINT_HPP
@@ -11,13 +11,36 @@
 #ifndef COMMON_HPP
 #define COMMON_HPP
 
+#include <algorithm>
+#include <atomic>
 #include <cfloat>
 #include <cmath>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <random>
 #include <stdlib.h>
+#include <string>
+#include <thread>
 #include <vector>
 
+// Checkpointing and early stopping of the ant and genetic algorithms. No
+// snapshots are written when state_file_name is empty, and a run only stops
+// early on its gap to lower_bound when lower_bound is positive.
+struct SolverOptions
+{
+    std::string state_file_name;
+    std::vector<int> original_ids;
+    int checkpoint_interval;
+    float lower_bound;
+    float target_gap;
+
+    SolverOptions()
+        : checkpoint_interval(0), lower_bound(0), target_gap(0)
+    {
+    }
+};
+
 void generate_vertices(const std::string& file_name,
                        const int& height,
                        const int& width,
@@ -25,9 +48,33 @@ void generate_vertices(const std::string& file_name,
                        const int& border,
                        const int& number_of_vertices,
                        std::vector<std::vector<int>>& vertices);
+float compute_cost(const std::vector<int>& vertex_1,
+                   const std::vector<int>& vertex_2);
+// The file is written in the original numbering of the vertices, which
+// original_ids maps the indices to, or in the order of vertices if it is empty.
 void compute_cost_matrix(const std::string& file_name,
                          const int& number_of_vertices,
                          const std::vector<std::vector<int>>& vertices,
+                         const std::vector<int>& original_ids,
                          std::vector<std::vector<float>>& cost_matrix);
+// Lists the number_of_candidates nearest vertices of every vertex, nearest first.
+void compute_candidates(const int& number_of_vertices,
+                        const int& number_of_candidates,
+                        const std::vector<std::vector<float>>& cost_matrix,
+                        std::vector<std::vector<int>>& candidates);
+
+// Returns a random number in [0, RAND_MAX] like rand(). rand() is serialised
+// by a lock shared by all threads, so solvers running in parallel draw from a
+// generator of their own thread instead, set by set_random_generator(). A
+// thread without one, or after a call with nullptr, falls back to rand().
+// Seeds for parallel work are drawn serially before parallel_for(), so that
+// the results only depend on the seed of rand(), not on the thread scheduling.
+int random_number();
+void set_random_generator(std::minstd_rand* generator);
+
+// Runs body(i) for every i in [begin, end) on all hardware threads.
+void parallel_for(const int& begin,
+                  const int& end,
+                  const std::function<void(const int&)>& body);
 
 #endif // COMMON_HPP
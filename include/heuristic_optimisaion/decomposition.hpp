@@ -0,0 +1,61 @@
+/**
+ * @file decomposition.hpp
+ * @author Nguyen Quang <nqoptik@gmail.com>
+ * @brief Hierarchical decomposition of large instances into clusters.
+ * @since 0.0.2
+ *
+ * @copyright Copyright (c) 2016, Nguyen Quang, all rights reserved.
+ *
+ */
+
+#ifndef DECOMPOSITION_HPP
+#define DECOMPOSITION_HPP
+
+#include <algorithm>
+#include <cfloat>
+#include <vector>
+
+#include "heuristic_optimisaion/ant.hpp"
+#include "heuristic_optimisaion/common.hpp"
+#include "heuristic_optimisaion/genetic.hpp"
+#include "heuristic_optimisaion/greedy.hpp"
+#include "heuristic_optimisaion/hilbert_curve.hpp"
+
+// The methods of solving the clusters.
+const int greedy_method = 0;
+const int ant_method = 1;
+const int genetic_method = 2;
+
+void partition(const int& cluster_size,
+               const std::vector<std::vector<int>>& vertices,
+               std::vector<std::vector<int>>& clusters);
+// The ant and genetic algorithms draw from a generator seeded with seed, so
+// that clusters solved in parallel do not contend on rand().
+void solve_cluster(const int& method,
+                   const unsigned int& seed,
+                   const std::vector<std::vector<int>>& vertices,
+                   const std::vector<int>& cluster,
+                   std::vector<int>& tour);
+void solve_cluster_order(const std::vector<std::vector<int>>& vertices,
+                         const std::vector<std::vector<int>>& clusters,
+                         std::vector<int>& cluster_order);
+void stitch(const std::vector<std::vector<int>>& vertices,
+            const std::vector<std::vector<int>>& cluster_tours,
+            const std::vector<int>& cluster_order,
+            std::vector<int>& tour,
+            std::vector<int>& junctions);
+void polish(const int& window_size,
+            const std::vector<std::vector<int>>& vertices,
+            const std::vector<int>& junctions,
+            std::vector<int>& tour);
+
+// Only one cost matrix of cluster_size * cluster_size is held per thread, and
+// one of the number of clusters for ordering the clusters.
+void decomposition(const int& method,
+                   const int& cluster_size,
+                   const int& window_size,
+                   const std::vector<std::vector<int>>& vertices,
+                   std::vector<int>& tour,
+                   float& cost);
+
+#endif // DECOMPOSITION_HPP
@@ -0,0 +1,71 @@
+/**
+ * @file dynamic_instance.hpp
+ * @author Nguyen Quang <nqoptik@gmail.com>
+ * @brief Incremental updates of instances and solver states when vertices are added or removed.
+ * @since 0.0.2
+ *
+ * @copyright Copyright (c) 2016, Nguyen Quang, all rights reserved.
+ *
+ */
+
+#ifndef DYNAMIC_INSTANCE_HPP
+#define DYNAMIC_INSTANCE_HPP
+
+#include <cfloat>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "heuristic_optimisaion/common.hpp"
+
+// A new vertex always takes the last index. A removed vertex is replaced by
+// the last vertex, whose old index is returned as moved_vertex (or -1 if the
+// removed vertex was the last one), so only one row and one column change.
+// The original numbering of the vertices changes in the same way, and
+// original_ids is kept mapping the indices to it, so that tours and snapshots
+// saved through it match the vertices saved by save_vertices(). An empty
+// original_ids stays empty.
+void insert_vertex(const std::vector<int>& vertex,
+                   std::vector<std::vector<int>>& vertices,
+                   std::vector<std::vector<float>>& cost_matrix,
+                   std::vector<int>& original_ids);
+void remove_vertex(const int& vertex_index,
+                   std::vector<std::vector<int>>& vertices,
+                   std::vector<std::vector<float>>& cost_matrix,
+                   std::vector<int>& original_ids,
+                   int& moved_vertex);
+void insert_original_id(std::vector<int>& original_ids);
+void remove_original_id(const int& vertex_index,
+                        std::vector<int>& original_ids);
+// Writes the vertices in their original numbering, in the format of
+// generate_vertices().
+void save_vertices(const std::string& file_name,
+                   const std::vector<int>& original_ids,
+                   const std::vector<std::vector<int>>& vertices);
+
+void insert_matrix_vertex(const float& value,
+                          std::vector<std::vector<float>>& matrix);
+void remove_matrix_vertex(const int& vertex_index,
+                          std::vector<std::vector<float>>& matrix);
+
+void insert_tour_vertex(const int& vertex,
+                        const std::vector<std::vector<float>>& cost_matrix,
+                        std::vector<int>& tour,
+                        float& cost);
+void remove_tour_vertex(const int& vertex_index,
+                        const int& moved_vertex,
+                        const std::vector<std::vector<float>>& cost_matrix,
+                        std::vector<int>& tour,
+                        float& cost);
+
+void insert_population_vertex(const int& vertex,
+                              const std::vector<std::vector<float>>& cost_matrix,
+                              std::vector<std::vector<int>>& population,
+                              std::vector<float>& current_costs);
+void remove_population_vertex(const int& vertex_index,
+                              const int& moved_vertex,
+                              const std::vector<std::vector<float>>& cost_matrix,
+                              std::vector<std::vector<int>>& population,
+                              std::vector<float>& current_costs);
+
+#endif // DYNAMIC_INSTANCE_HPP
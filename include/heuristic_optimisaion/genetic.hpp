@@ -0,0 +1,74 @@
+/**
+ * @file genetic.hpp
+ * @author Nguyen Quang <nqoptik@gmail.com>
+ * @brief The genetic algorithm.
+ * @since 0.0.1
+ * 
+ * @copyright Copyright (c) 2016, Nguyen Quang, all rights reserved.
+ * 
+ */
+
+#ifndef GENETIC_HPP
+#define GENETIC_HPP
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "heuristic_optimisaion/common.hpp"
+
+void genetic(const int& number_of_vertices,
+             const int& population_size,
+             const int& hybridization_size,
+             const int& mutation_size,
+             const int& number_of_generations,
+             const float& seeding_fraction,
+             const std::vector<std::vector<float>>& cost_matrix,
+             const std::vector<std::vector<int>>& initial_tours,
+             const SolverOptions& options,
+             std::vector<int>& tour,
+             float& cost);
+void initialise(const int& number_of_vertices,
+                const int& population_size,
+                const float& seeding_fraction,
+                const std::vector<std::vector<float>>& cost_matrix,
+                std::vector<std::vector<int>>& population);
+void hybridise(const int& number_of_vertices,
+               const std::vector<int>& tour_1,
+               const std::vector<int>& tour_2,
+               std::vector<int>& tour_1_,
+               std::vector<int>& tour_2_,
+               const int& from,
+               const int& to);
+void mutate(const int& number_of_vertices,
+            const std::vector<int>& tour,
+            std::vector<int>& tour_,
+            const int& method,
+            int& from,
+            int& to);
+// The hash is the XOR of hashes of the undirected edges of the tour, so it
+// does not depend on the start vertex nor on the direction of the tour.
+unsigned long long hash_tour(const int& number_of_vertices,
+                             const std::vector<int>& tour);
+void evaluate(const int& number_of_vertices,
+              const int& from,
+              const int& to,
+              const std::vector<std::vector<float>>& cost_matrix,
+              const std::vector<std::vector<int>>& population,
+              std::vector<float>& current_costs,
+              std::vector<unsigned long long>& hashes,
+              std::unordered_map<unsigned long long, float>& fitness_cache);
+void select(const int& population_size,
+            const int& hybridization_size,
+            const int& mutation_size,
+            std::vector<std::vector<int>>& population,
+            std::vector<float>& current_costs,
+            std::vector<unsigned long long>& hashes);
+
+#endif // GENETIC_HPP
@@ -0,0 +1,53 @@
+/**
+ * @file greedy.hpp
+ * @author Nguyen Quang <nqoptik@gmail.com>
+ * @brief The greedy algorithm.
+ * @since 0.0.1
+ * 
+ * @copyright Copyright (c) 2016, Nguyen Quang, all rights reserved.
+ * 
+ */
+
+#ifndef GREEDY_HPP
+#define GREEDY_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <climits>
+#include <cmath>
+#include <mutex>
+#include <vector>
+
+#include "heuristic_optimisaion/common.hpp"
+
+void greedy(const int& number_of_vertices,
+            const int& start,
+            const std::vector<std::vector<float>>& cost_matrix,
+            std::vector<int>& tour,
+            float& cost);
+
+// Builds the nearest-neighbour tour from start in about O(N * k) time instead
+// of O(N^2), with the candidate lists of compute_candidates().
+void candidate_greedy(const int& number_of_vertices,
+                      const int& start,
+                      const std::vector<std::vector<int>>& candidates,
+                      const std::vector<std::vector<float>>& cost_matrix,
+                      std::vector<int>& tour,
+                      float& cost);
+
+// Builds nearest-neighbour tours from number_of_starts evenly spread start
+// vertices in parallel, and returns the number_of_tours cheapest ones,
+// cheapest first. A construction is abandoned as soon as a lower bound on its
+// final cost exceeds the cost of the worst tour kept so far. If the costs are
+// the distances between the vertices, the nearest unvisited vertex is looked
+// up in a grid over the vertices, otherwise pass no vertices.
+void multi_start_greedy(const int& number_of_vertices,
+                        const int& number_of_starts,
+                        const int& number_of_tours,
+                        const std::vector<std::vector<int>>& vertices,
+                        const std::vector<std::vector<float>>& cost_matrix,
+                        std::vector<std::vector<int>>& tours,
+                        std::vector<float>& costs);
+
+#endif // GREEDY_HPP
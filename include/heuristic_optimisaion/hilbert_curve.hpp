@@ -0,0 +1,35 @@
+/**
+ * @file hilbert_curve.hpp
+ * @author Nguyen Quang <nqoptik@gmail.com>
+ * @brief Ordering of vertices along a Hilbert curve.
+ * @since 0.0.2
+ *
+ * @copyright Copyright (c) 2016, Nguyen Quang, all rights reserved.
+ *
+ */
+
+#ifndef HILBERT_CURVE_HPP
+#define HILBERT_CURVE_HPP
+
+#include <algorithm>
+#include <vector>
+
+// Coordinates are taken relative to the bounding box of the vertices and must
+// span less than 65536 in both directions.
+long long hilbert_index(const int& x,
+                        const int& y);
+void compute_hilbert_order(const std::vector<std::vector<int>>& vertices,
+                           std::vector<int>& order);
+
+// Renumbers the vertices along the Hilbert curve so that nearby vertices get
+// nearby rows in the cost, pheromone and heuristic matrices. original_ids maps
+// the new indices back to the original ones, tours are left as they are when
+// original_ids is empty.
+void renumber_vertices(std::vector<std::vector<int>>& vertices,
+                       std::vector<int>& original_ids);
+void renumber_tour(const std::vector<int>& original_ids,
+                   std::vector<int>& tour);
+void restore_tour(const std::vector<int>& original_ids,
+                  std::vector<int>& tour);
+
+#endif // HILBERT_CURVE_HPP
@@ -0,0 +1,46 @@
+/**
+ * @file lower_bound.hpp
+ * @author Nguyen Quang <nqoptik@gmail.com>
+ * @brief The Held-Karp lower bound of tour costs.
+ * @since 0.0.2
+ *
+ * @copyright Copyright (c) 2016, Nguyen Quang, all rights reserved.
+ *
+ */
+
+#ifndef LOWER_BOUND_HPP
+#define LOWER_BOUND_HPP
+
+#include <cfloat>
+#include <functional>
+#include <queue>
+#include <vector>
+
+#include "heuristic_optimisaion/common.hpp"
+
+// Computes the minimum 1-tree of the costs modified by the penalties, with
+// vertex 0 as the special vertex. Returns the degrees of the vertices in it.
+void compute_one_tree(const int& number_of_vertices,
+                      const std::vector<std::vector<int>>& adjacency,
+                      const std::vector<std::vector<float>>& cost_matrix,
+                      const std::vector<double>& penalties,
+                      double& one_tree_cost,
+                      std::vector<int>& degrees);
+void compute_dense_one_tree(const int& number_of_vertices,
+                            const std::vector<std::vector<float>>& cost_matrix,
+                            const std::vector<double>& penalties,
+                            double& one_tree_cost,
+                            std::vector<int>& degrees);
+
+// The subgradient ascent runs on the candidate graph, so each iteration costs
+// O(E log N). The final bound is evaluated once on the complete graph, so it
+// is a valid lower bound even where the candidate graph misses edges.
+// upper_bound is the cost of any tour, e.g. the greedy one.
+void compute_lower_bound(const int& number_of_vertices,
+                         const int& number_of_candidates,
+                         const int& number_of_iterations,
+                         const float& upper_bound,
+                         const std::vector<std::vector<float>>& cost_matrix,
+                         float& lower_bound);
+
+#endif // LOWER_BOUND_HPP
@@ -0,0 +1,68 @@
+/**
+ * @file sparse_graph.hpp
+ * @author Nguyen Quang <nqoptik@gmail.com>
+ * @brief Sparse graphs in compressed sparse row form and the solvers on them.
+ * @since 0.0.2
+ *
+ * @copyright Copyright (c) 2016, Nguyen Quang, all rights reserved.
+ *
+ */
+
+#ifndef SPARSE_GRAPH_HPP
+#define SPARSE_GRAPH_HPP
+
+#include <algorithm>
+#include <cfloat>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <queue>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "heuristic_optimisaion/common.hpp"
+
+// The neighbours of vertex i are neighbours[offsets[i]] to
+// neighbours[offsets[i + 1] - 1], with the costs of the edges in weights.
+struct SparseGraph
+{
+    int number_of_vertices;
+    std::vector<int> offsets;
+    std::vector<int> neighbours;
+    std::vector<float> weights;
+};
+
+// Every edge is added in both directions.
+void build_sparse_graph(const int& number_of_vertices,
+                        const std::vector<int>& sources,
+                        const std::vector<int>& targets,
+                        const std::vector<float>& edge_weights,
+                        SparseGraph& graph);
+// The file holds the number of vertices and edges, then one edge per line as
+// "source target weight".
+bool load_sparse_graph(const std::string& file_name,
+                       SparseGraph& graph);
+void build_nearest_neighbour_graph(const std::vector<std::vector<int>>& vertices,
+                                   const int& number_of_neighbours,
+                                   SparseGraph& graph);
+
+// Costs of vertex pairs without an edge are the shortest path costs, which
+// are computed on demand. The graph is expected to be connected.
+float shortest_path_cost(const SparseGraph& graph,
+                         const int& from,
+                         const int& to);
+float sparse_tour_cost(const SparseGraph& graph,
+                       const std::vector<int>& tour);
+
+void sparse_greedy(const SparseGraph& graph,
+                   const int& start,
+                   std::vector<int>& tour,
+                   float& cost);
+void sparse_ant(const SparseGraph& graph,
+                const int& number_of_ants,
+                const float& evaporation,
+                std::vector<int>& tour,
+                float& cost);
+
+#endif // SPARSE_GRAPH_HPP
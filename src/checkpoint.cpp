@@ -0,0 +1,351 @@
+/**
+ * @file checkpoint.cpp
+ * @author Nguyen Quang <nqoptik@gmail.com>
+ * @brief Snapshots of solver states for resuming and warm-starting runs.
+ * @since 0.0.2
+ *
+ * @copyright Copyright (c) 2016, Nguyen Quang, all rights reserved.
+ *
+ */
+
+#include "heuristic_optimisaion/checkpoint.hpp"
+#include "heuristic_optimisaion/hilbert_curve.hpp"
+
+static const int checkpoint_version = 2;
+static const char genetic_magic[4] = {'H', 'O', 'G', 'A'};
+static const char ant_magic[4] = {'H', 'O', 'A', 'C'};
+
+template <typename T>
+static void write_value(std::ofstream& fs, const T& value)
+{
+    fs.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+static bool read_value(std::ifstream& fs, T& value)
+{
+    fs.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return fs.good();
+}
+
+template <typename T>
+static void write_vector(std::ofstream& fs, const std::vector<T>& values)
+{
+    int size = static_cast<int>(values.size());
+    write_value(fs, size);
+    if (size > 0)
+    {
+        fs.write(reinterpret_cast<const char*>(&values[0]), sizeof(T) * size);
+    }
+}
+
+// The number of bytes left in the file, which bounds the sizes read from it so
+// that a corrupt size is rejected instead of being allocated.
+static long long remaining_bytes(std::ifstream& fs)
+{
+    std::streampos position = fs.tellg();
+    fs.seekg(0, std::ios::end);
+    std::streampos end = fs.tellg();
+    fs.seekg(position);
+    return static_cast<long long>(end - position);
+}
+
+template <typename T>
+static bool read_vector(std::ifstream& fs, std::vector<T>& values)
+{
+    int size = 0;
+    if (!read_value(fs, size) || size < 0 ||
+        static_cast<long long>(size) > remaining_bytes(fs) / static_cast<long long>(sizeof(T)))
+    {
+        return false;
+    }
+    values = std::vector<T>(size);
+    if (size > 0)
+    {
+        fs.read(reinterpret_cast<char*>(&values[0]), sizeof(T) * size);
+    }
+    return fs.good();
+}
+
+static void write_header(std::ofstream& fs, const char* magic)
+{
+    fs.write(magic, 4);
+    write_value(fs, checkpoint_version);
+
+    unsigned int seed = static_cast<unsigned int>(rand());
+    srand(seed);
+    write_value(fs, seed);
+}
+
+static bool read_header(std::ifstream& fs, const char* magic, unsigned int& seed)
+{
+    char file_magic[4];
+    fs.read(file_magic, 4);
+    int version = 0;
+    if (!fs.good() || !read_value(fs, version) || !read_value(fs, seed))
+    {
+        return false;
+    }
+    for (int i = 0; i < 4; ++i)
+    {
+        if (file_magic[i] != magic[i])
+        {
+            return false;
+        }
+    }
+    return version == checkpoint_version;
+}
+
+// Snapshots are written to a temporary file first so that a job pre-empted in
+// the middle of a save, or a failed write, never leaves a truncated snapshot
+// behind. The previous snapshot is kept whenever the new one is incomplete.
+static bool commit_file(std::ofstream& fs, const std::string& temporary_file_name, const std::string& file_name)
+{
+    bool is_written = fs.good();
+    fs.close();
+    if (!is_written || fs.fail() || std::rename(temporary_file_name.c_str(), file_name.c_str()) != 0)
+    {
+        std::cerr << "Failed to write " << file_name << std::endl;
+        std::remove(temporary_file_name.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool is_valid_tour(const int& number_of_vertices,
+                   const std::vector<int>& tour)
+{
+    if (static_cast<int>(tour.size()) != number_of_vertices)
+    {
+        return false;
+    }
+    std::vector<bool> has_been_visited = std::vector<bool>(number_of_vertices, false);
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        if (tour[i] < 0 || tour[i] >= number_of_vertices || has_been_visited[tour[i]])
+        {
+            return false;
+        }
+        has_been_visited[tour[i]] = true;
+    }
+    return true;
+}
+
+void save_tour(const std::string& file_name,
+               const std::vector<int>& tour)
+{
+    std::ofstream fs;
+    fs.open(file_name.c_str());
+    fs << tour.size() << std::endl;
+    for (size_t i = 0; i < tour.size(); ++i)
+    {
+        fs << tour[i] << std::endl;
+    }
+    fs.close();
+}
+
+bool load_tour(const std::string& file_name,
+               const int& number_of_vertices,
+               std::vector<int>& tour)
+{
+    std::ifstream fs;
+    fs.open(file_name.c_str());
+    int tour_size = 0;
+    if (!(fs >> tour_size) || tour_size != number_of_vertices)
+    {
+        return false;
+    }
+    std::vector<int> loaded_tour = std::vector<int>(tour_size);
+    for (int i = 0; i < tour_size; ++i)
+    {
+        if (!(fs >> loaded_tour[i]))
+        {
+            return false;
+        }
+    }
+    if (!is_valid_tour(number_of_vertices, loaded_tour))
+    {
+        return false;
+    }
+    tour = loaded_tour;
+    return true;
+}
+
+void save_genetic_state(const std::string& file_name,
+                        const std::vector<int>& original_ids,
+                        const int& generation,
+                        const std::vector<std::vector<int>>& population,
+                        const std::vector<float>& current_costs)
+{
+    std::string temporary_file_name = file_name + ".tmp";
+    std::ofstream fs;
+    fs.open(temporary_file_name.c_str(), std::ios::binary);
+    write_header(fs, genetic_magic);
+    write_value(fs, generation);
+    write_vector(fs, current_costs);
+    int population_size = static_cast<int>(population.size());
+    write_value(fs, population_size);
+    for (int i = 0; i < population_size; ++i)
+    {
+        std::vector<int> original_tour = population[i];
+        restore_tour(original_ids, original_tour);
+        write_vector(fs, original_tour);
+    }
+    commit_file(fs, temporary_file_name, file_name);
+}
+
+bool load_genetic_state(const std::string& file_name,
+                        const std::vector<int>& original_ids,
+                        const int& number_of_vertices,
+                        int& generation,
+                        std::vector<std::vector<int>>& population,
+                        std::vector<float>& current_costs)
+{
+    std::ifstream fs;
+    fs.open(file_name.c_str(), std::ios::binary);
+    unsigned int seed = 0;
+    if (!read_header(fs, genetic_magic, seed))
+    {
+        return false;
+    }
+
+    int loaded_generation = 0;
+    std::vector<float> loaded_costs;
+    int population_size = 0;
+    if (!read_value(fs, loaded_generation) || !read_vector(fs, loaded_costs) ||
+        !read_value(fs, population_size) || population_size < 0 ||
+        static_cast<long long>(population_size) > remaining_bytes(fs) / static_cast<long long>(sizeof(int)))
+    {
+        return false;
+    }
+    std::vector<std::vector<int>> loaded_population = std::vector<std::vector<int>>(population_size);
+    for (int i = 0; i < population_size; ++i)
+    {
+        if (!read_vector(fs, loaded_population[i]) ||
+            !is_valid_tour(number_of_vertices, loaded_population[i]))
+        {
+            return false;
+        }
+        renumber_tour(original_ids, loaded_population[i]);
+    }
+
+    srand(seed);
+    generation = loaded_generation;
+    population = loaded_population;
+    current_costs = loaded_costs;
+    return true;
+}
+
+void save_ant_state(const std::string& file_name,
+                    const std::vector<int>& original_ids,
+                    const int& ant,
+                    const int& stop_count,
+                    const std::vector<std::vector<float>>& pheromone,
+                    const std::vector<int>& tour,
+                    const float& cost)
+{
+    std::string temporary_file_name = file_name + ".tmp";
+    std::ofstream fs;
+    fs.open(temporary_file_name.c_str(), std::ios::binary);
+    write_header(fs, ant_magic);
+    write_value(fs, ant);
+    write_value(fs, stop_count);
+    write_value(fs, cost);
+    std::vector<int> original_tour = tour;
+    restore_tour(original_ids, original_tour);
+    write_vector(fs, original_tour);
+    int number_of_vertices = static_cast<int>(pheromone.size());
+    write_value(fs, number_of_vertices);
+    if (original_ids.empty())
+    {
+        for (int i = 0; i < number_of_vertices; ++i)
+        {
+            write_vector(fs, pheromone[i]);
+        }
+    }
+    else
+    {
+        // The rows are restored one at a time, so that no second pheromone
+        // matrix is held while saving.
+        std::vector<int> new_ids = std::vector<int>(number_of_vertices);
+        for (int i = 0; i < number_of_vertices; ++i)
+        {
+            new_ids[original_ids[i]] = i;
+        }
+        std::vector<float> original_row = std::vector<float>(number_of_vertices);
+        for (int i = 0; i < number_of_vertices; ++i)
+        {
+            for (int j = 0; j < number_of_vertices; ++j)
+            {
+                original_row[j] = pheromone[new_ids[i]][new_ids[j]];
+            }
+            write_vector(fs, original_row);
+        }
+    }
+    commit_file(fs, temporary_file_name, file_name);
+}
+
+bool load_ant_state(const std::string& file_name,
+                    const std::vector<int>& original_ids,
+                    const int& number_of_vertices,
+                    int& ant,
+                    int& stop_count,
+                    std::vector<std::vector<float>>& pheromone,
+                    std::vector<int>& tour,
+                    float& cost)
+{
+    std::ifstream fs;
+    fs.open(file_name.c_str(), std::ios::binary);
+    unsigned int seed = 0;
+    if (!read_header(fs, ant_magic, seed))
+    {
+        return false;
+    }
+
+    int loaded_ant = 0;
+    int loaded_stop_count = 0;
+    float loaded_cost = 0;
+    std::vector<int> loaded_tour;
+    int loaded_number_of_vertices = 0;
+    if (!read_value(fs, loaded_ant) || !read_value(fs, loaded_stop_count) ||
+        !read_value(fs, loaded_cost) || !read_vector(fs, loaded_tour) ||
+        !read_value(fs, loaded_number_of_vertices) ||
+        loaded_number_of_vertices != number_of_vertices ||
+        !is_valid_tour(number_of_vertices, loaded_tour))
+    {
+        return false;
+    }
+
+    // The rows are renumbered as they are read, so that no second pheromone
+    // matrix is held while loading.
+    std::vector<int> new_ids = std::vector<int>(number_of_vertices);
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        new_ids[original_ids.empty() ? i : original_ids[i]] = i;
+    }
+    std::vector<std::vector<float>> loaded_pheromone = std::vector<std::vector<float>>(number_of_vertices);
+    std::vector<float> original_row;
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        if (!read_vector(fs, original_row) ||
+            static_cast<int>(original_row.size()) != number_of_vertices)
+        {
+            return false;
+        }
+        std::vector<float>& row = loaded_pheromone[new_ids[i]];
+        row = std::vector<float>(number_of_vertices);
+        for (int j = 0; j < number_of_vertices; ++j)
+        {
+            row[new_ids[j]] = original_row[j];
+        }
+    }
+
+    renumber_tour(original_ids, loaded_tour);
+    srand(seed);
+    ant = loaded_ant;
+    stop_count = loaded_stop_count;
+    pheromone.swap(loaded_pheromone);
+    tour = loaded_tour;
+    cost = loaded_cost;
+    return true;
+}
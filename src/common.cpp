@@ -34,9 +34,18 @@ void generate_vertices(const std::string& file_name,
     fs.close();
 }
 
+float compute_cost(const std::vector<int>& vertex_1,
+                   const std::vector<int>& vertex_2)
+{
+    int dx = vertex_1[0] - vertex_2[0];
+    int dy = vertex_1[1] - vertex_2[1];
+    return sqrt(dx * dx + dy * dy);
+}
+
 void compute_cost_matrix(const std::string& file_name,
                          const int& number_of_vertices,
                          const std::vector<std::vector<int>>& vertices,
+                         const std::vector<int>& original_ids,
                          std::vector<std::vector<float>>& cost_matrix)
 {
     cost_matrix = std::vector<std::vector<float>>(number_of_vertices);
@@ -51,13 +60,16 @@ void compute_cost_matrix(const std::string& file_name,
             }
             else
             {
-                int dx = vertices[i][0] - vertices[j][0];
-                int dy = vertices[i][1] - vertices[j][1];
-                cost_matrix[i][j] = sqrt(dx * dx + dy * dy);
+                cost_matrix[i][j] = compute_cost(vertices[i], vertices[j]);
             }
         }
     }
 
+    std::vector<int> new_ids = std::vector<int>(number_of_vertices);
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        new_ids[original_ids.empty() ? i : original_ids[i]] = i;
+    }
     std::ofstream fs;
     fs.open(file_name.c_str());
     fs << number_of_vertices << std::endl;
@@ -65,9 +77,99 @@ void compute_cost_matrix(const std::string& file_name,
     {
         for (int j = 0; j < number_of_vertices; ++j)
         {
-            fs << cost_matrix[i][j] << " ";
+            fs << cost_matrix[new_ids[i]][new_ids[j]] << " ";
         }
         fs << std::endl;
     }
     fs.close();
 }
+
+void compute_candidates(const int& number_of_vertices,
+                        const int& number_of_candidates,
+                        const std::vector<std::vector<float>>& cost_matrix,
+                        std::vector<std::vector<int>>& candidates)
+{
+    int candidate_size = std::max(0, std::min(number_of_candidates, number_of_vertices - 1));
+    candidates = std::vector<std::vector<int>>(number_of_vertices);
+    parallel_for(0, number_of_vertices, [&](const int& i)
+    {
+        std::vector<int> neighbours;
+        neighbours.reserve(number_of_vertices - 1);
+        for (int j = 0; j < number_of_vertices; ++j)
+        {
+            if (j != i)
+            {
+                neighbours.push_back(j);
+            }
+        }
+        std::partial_sort(neighbours.begin(), neighbours.begin() + candidate_size, neighbours.end(),
+                          [&](const int& a, const int& b)
+                          { return cost_matrix[i][a] < cost_matrix[i][b]; });
+        candidates[i] = std::vector<int>(neighbours.begin(), neighbours.begin() + candidate_size);
+    });
+}
+
+static thread_local std::minstd_rand* random_generator = nullptr;
+
+int random_number()
+{
+    if (random_generator == nullptr)
+    {
+        return rand();
+    }
+    return std::uniform_int_distribution<int>(0, RAND_MAX)(*random_generator);
+}
+
+void set_random_generator(std::minstd_rand* generator)
+{
+    random_generator = generator;
+}
+
+// Nested calls run serially on the calling worker instead of oversubscribing
+// the cores, e.g. when the genetic algorithm is run per cluster in parallel.
+static thread_local bool is_parallel_worker = false;
+
+void parallel_for(const int& begin,
+                  const int& end,
+                  const std::function<void(const int&)>& body)
+{
+    if (is_parallel_worker)
+    {
+        for (int i = begin; i < end; ++i)
+        {
+            body(i);
+        }
+        return;
+    }
+
+    int number_of_threads = static_cast<int>(std::thread::hardware_concurrency());
+    if (number_of_threads > end - begin)
+    {
+        number_of_threads = end - begin;
+    }
+    if (number_of_threads < 1)
+    {
+        number_of_threads = 1;
+    }
+
+    std::atomic<int> next_index(begin);
+    auto worker = [&]()
+    {
+        is_parallel_worker = true;
+        for (int i = next_index++; i < end; i = next_index++)
+        {
+            body(i);
+        }
+        is_parallel_worker = false;
+    };
+    std::vector<std::thread> threads;
+    for (int i = 1; i < number_of_threads; ++i)
+    {
+        threads.push_back(std::thread(worker));
+    }
+    worker();
+    for (size_t i = 0; i < threads.size(); ++i)
+    {
+        threads[i].join();
+    }
+}
@@ -0,0 +1,348 @@
+/**
+ * @file decomposition.cpp
+ * @author Nguyen Quang <nqoptik@gmail.com>
+ * @brief Hierarchical decomposition of large instances into clusters.
+ * @since 0.0.2
+ *
+ * @copyright Copyright (c) 2016, Nguyen Quang, all rights reserved.
+ *
+ */
+
+#include "heuristic_optimisaion/decomposition.hpp"
+
+static void compute_centroid(const std::vector<std::vector<int>>& vertices,
+                             const std::vector<int>& cluster,
+                             std::vector<int>& centroid)
+{
+    long long sum_x = 0;
+    long long sum_y = 0;
+    for (size_t i = 0; i < cluster.size(); ++i)
+    {
+        sum_x += vertices[cluster[i]][0];
+        sum_y += vertices[cluster[i]][1];
+    }
+    long long cluster_size = cluster.empty() ? 1 : static_cast<long long>(cluster.size());
+    centroid = std::vector<int>(2);
+    centroid[0] = static_cast<int>(sum_x / cluster_size);
+    centroid[1] = static_cast<int>(sum_y / cluster_size);
+}
+
+static void build_cost_matrix(const std::vector<std::vector<int>>& vertices,
+                              std::vector<std::vector<float>>& cost_matrix)
+{
+    int number_of_vertices = static_cast<int>(vertices.size());
+    cost_matrix = std::vector<std::vector<float>>(number_of_vertices);
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        cost_matrix[i] = std::vector<float>(number_of_vertices);
+        for (int j = 0; j < number_of_vertices; ++j)
+        {
+            cost_matrix[i][j] = i == j ? FLT_MAX : compute_cost(vertices[i], vertices[j]);
+        }
+    }
+}
+
+// Cost from the vertex to the nearest vertex of the cluster.
+static float compute_nearest_cost(const std::vector<std::vector<int>>& vertices,
+                                  const int& vertex,
+                                  const std::vector<int>& cluster)
+{
+    float min_cost = FLT_MAX;
+    for (size_t i = 0; i < cluster.size(); ++i)
+    {
+        min_cost = std::min(min_cost, compute_cost(vertices[vertex], vertices[cluster[i]]));
+    }
+    return min_cost;
+}
+
+// Applies improving 2-opt moves to the edges between positions first and last
+// of the tour until none is left. The reversed segments never leave the window.
+template <typename Cost>
+static void improve_two_opt(const Cost& cost,
+                            const int& first,
+                            const int& last,
+                            std::vector<int>& tour)
+{
+    bool is_improved = true;
+    while (is_improved)
+    {
+        is_improved = false;
+        for (int i = first; i < last - 1; ++i)
+        {
+            for (int j = i + 2; j < last; ++j)
+            {
+                float delta = cost(tour[i], tour[j]) + cost(tour[i + 1], tour[j + 1]) -
+                              cost(tour[i], tour[i + 1]) - cost(tour[j], tour[j + 1]);
+                if (delta < -1e-3f)
+                {
+                    std::reverse(tour.begin() + i + 1, tour.begin() + j + 1);
+                    is_improved = true;
+                }
+            }
+        }
+    }
+}
+
+void partition(const int& cluster_size,
+               const std::vector<std::vector<int>>& vertices,
+               std::vector<std::vector<int>>& clusters)
+{
+    int number_of_vertices = static_cast<int>(vertices.size());
+    std::vector<int> order;
+    compute_hilbert_order(vertices, order);
+
+    int number_of_clusters = (number_of_vertices + cluster_size - 1) / cluster_size;
+    clusters = std::vector<std::vector<int>>(number_of_clusters);
+    for (int i = 0; i < number_of_clusters; ++i)
+    {
+        int from = static_cast<int>(static_cast<long long>(i) * number_of_vertices / number_of_clusters);
+        int to = static_cast<int>(static_cast<long long>(i + 1) * number_of_vertices / number_of_clusters);
+        clusters[i] = std::vector<int>(order.begin() + from, order.begin() + to);
+    }
+}
+
+void solve_cluster(const int& method,
+                   const unsigned int& seed,
+                   const std::vector<std::vector<int>>& vertices,
+                   const std::vector<int>& cluster,
+                   std::vector<int>& tour)
+{
+    int number_of_vertices = static_cast<int>(cluster.size());
+    if (number_of_vertices <= 3)
+    {
+        tour = cluster;
+        return;
+    }
+
+    std::vector<std::vector<int>> cluster_vertices = std::vector<std::vector<int>>(number_of_vertices);
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        cluster_vertices[i] = vertices[cluster[i]];
+    }
+    std::vector<std::vector<float>> cost_matrix;
+    build_cost_matrix(cluster_vertices, cost_matrix);
+
+    // The cluster tour is improved by 2-opt whichever method built it.
+    std::vector<int> cluster_tour;
+    float cluster_cost;
+    std::minstd_rand generator(seed);
+    set_random_generator(&generator);
+    if (method == ant_method)
+    {
+        int number_of_ants = 10 * number_of_vertices;
+        float evaporation = 0.8;
+        std::vector<int> initial_tour;
+        std::vector<std::vector<float>> pheromone;
+        int width = 0;
+        int height = 0;
+        int border = 0;
+        bool verbose = false;
+        ant(number_of_vertices, number_of_ants, evaporation, cluster_vertices, width, height, border, cost_matrix,
+            initial_tour, pheromone, SolverOptions(), verbose, cluster_tour, cluster_cost);
+    }
+    else if (method == genetic_method)
+    {
+        int population_size = 100;
+        int hybridization_size = 30;
+        int mutation_size = 10;
+        int number_of_generations = 200;
+        float seeding_fraction = 0.1f;
+        std::vector<std::vector<int>> initial_tours;
+        genetic(number_of_vertices, population_size, hybridization_size, mutation_size,
+                number_of_generations, seeding_fraction, cost_matrix, initial_tours, SolverOptions(),
+                cluster_tour, cluster_cost);
+    }
+    else
+    {
+        greedy(number_of_vertices, 0, cost_matrix, cluster_tour, cluster_cost);
+    }
+    set_random_generator(nullptr);
+
+    cluster_tour.push_back(cluster_tour[0]);
+    improve_two_opt([&](const int& from, const int& to)
+                    { return cost_matrix[from][to]; },
+                    0, number_of_vertices, cluster_tour);
+
+    tour = std::vector<int>(number_of_vertices);
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        tour[i] = cluster[cluster_tour[i]];
+    }
+}
+
+void solve_cluster_order(const std::vector<std::vector<int>>& vertices,
+                         const std::vector<std::vector<int>>& clusters,
+                         std::vector<int>& cluster_order)
+{
+    int number_of_clusters = static_cast<int>(clusters.size());
+    if (number_of_clusters <= 3)
+    {
+        cluster_order = std::vector<int>(number_of_clusters);
+        for (int i = 0; i < number_of_clusters; ++i)
+        {
+            cluster_order[i] = i;
+        }
+        return;
+    }
+
+    std::vector<std::vector<int>> centroids = std::vector<std::vector<int>>(number_of_clusters);
+    for (int i = 0; i < number_of_clusters; ++i)
+    {
+        compute_centroid(vertices, clusters[i], centroids[i]);
+    }
+    std::vector<std::vector<float>> cost_matrix;
+    build_cost_matrix(centroids, cost_matrix);
+
+    float cluster_order_cost;
+    greedy(number_of_clusters, 0, cost_matrix, cluster_order, cluster_order_cost);
+
+    // The first cluster is repeated at the end so that the closing edge takes
+    // part in the 2-opt moves.
+    cluster_order.push_back(cluster_order[0]);
+    improve_two_opt([&](const int& from, const int& to)
+                    { return from == to ? 0.0f : cost_matrix[from][to]; },
+                    0, number_of_clusters, cluster_order);
+    cluster_order.pop_back();
+}
+
+void stitch(const std::vector<std::vector<int>>& vertices,
+            const std::vector<std::vector<int>>& cluster_tours,
+            const std::vector<int>& cluster_order,
+            std::vector<int>& tour,
+            std::vector<int>& junctions)
+{
+    int number_of_clusters = static_cast<int>(cluster_order.size());
+    tour.clear();
+    junctions.clear();
+
+    // Each cluster tour is cut at the edge whose removal gives the cheapest
+    // connections: the entry is joined to the exit of the previous cluster, and
+    // the exit to the nearest vertex of the next cluster. The exit of the last
+    // cluster is joined to the entry of the first one, and the entry of the
+    // first cluster to the nearest vertex of the last one.
+    int previous_vertex = -1;
+    for (int k = 0; k < number_of_clusters; ++k)
+    {
+        const std::vector<int>& cluster_tour = cluster_tours[cluster_order[k]];
+        int cluster_size = static_cast<int>(cluster_tour.size());
+        if (cluster_size == 0)
+        {
+            continue;
+        }
+        if (number_of_clusters == 1)
+        {
+            junctions.push_back(0);
+            tour = cluster_tour;
+            return;
+        }
+
+        std::vector<float> entry_costs = std::vector<float>(cluster_size);
+        std::vector<float> exit_costs = std::vector<float>(cluster_size);
+        const std::vector<int>& previous_cluster = cluster_tours[cluster_order[number_of_clusters - 1]];
+        const std::vector<int>& next_cluster = cluster_tours[cluster_order[(k + 1) % number_of_clusters]];
+        for (int i = 0; i < cluster_size; ++i)
+        {
+            entry_costs[i] = previous_vertex == -1
+                                 ? compute_nearest_cost(vertices, cluster_tour[i], previous_cluster)
+                                 : compute_cost(vertices[previous_vertex], vertices[cluster_tour[i]]);
+            exit_costs[i] = k == number_of_clusters - 1
+                                ? compute_cost(vertices[cluster_tour[i]], vertices[tour[0]])
+                                : compute_nearest_cost(vertices, cluster_tour[i], next_cluster);
+        }
+
+        // The cut edge (i, i + 1) is traversed either from i + 1 forwards to i,
+        // or from i backwards to i + 1.
+        float min_cost = FLT_MAX;
+        int entry = 0;
+        int direction = 1;
+        for (int i = 0; i < cluster_size; ++i)
+        {
+            int next = (i + 1) % cluster_size;
+            float edge_cost = compute_cost(vertices[cluster_tour[i]], vertices[cluster_tour[next]]);
+            float forward_cost = entry_costs[next] + exit_costs[i] - edge_cost;
+            float backward_cost = entry_costs[i] + exit_costs[next] - edge_cost;
+            if (forward_cost < min_cost)
+            {
+                min_cost = forward_cost;
+                entry = next;
+                direction = 1;
+            }
+            if (backward_cost < min_cost)
+            {
+                min_cost = backward_cost;
+                entry = i;
+                direction = cluster_size - 1;
+            }
+        }
+
+        junctions.push_back(static_cast<int>(tour.size()));
+        for (int i = 0; i < cluster_size; ++i)
+        {
+            tour.push_back(cluster_tour[(entry + direction * i) % cluster_size]);
+        }
+        previous_vertex = tour.back();
+    }
+}
+
+void polish(const int& window_size,
+            const std::vector<std::vector<int>>& vertices,
+            const std::vector<int>& junctions,
+            std::vector<int>& tour)
+{
+    int number_of_vertices = static_cast<int>(tour.size());
+    auto cost = [&](const int& from, const int& to)
+    { return compute_cost(vertices[from], vertices[to]); };
+    for (size_t i = 1; i < junctions.size(); ++i)
+    {
+        int first = std::max(0, junctions[i] - window_size);
+        int last = std::min(number_of_vertices - 1, junctions[i] + window_size);
+        improve_two_opt(cost, first, last, tour);
+    }
+
+    // The junction from the last cluster back to the first one is polished on
+    // the tour rotated so that the junction is inside the window.
+    if (junctions.size() > 1)
+    {
+        int shift = std::min(window_size, number_of_vertices / 2);
+        std::rotate(tour.begin(), tour.end() - shift, tour.end());
+        improve_two_opt(cost, 0, std::min(number_of_vertices - 1, 2 * shift), tour);
+        std::rotate(tour.begin(), tour.begin() + shift, tour.end());
+    }
+}
+
+void decomposition(const int& method,
+                   const int& cluster_size,
+                   const int& window_size,
+                   const std::vector<std::vector<int>>& vertices,
+                   std::vector<int>& tour,
+                   float& cost)
+{
+    std::vector<std::vector<int>> clusters;
+    partition(cluster_size, vertices, clusters);
+
+    int number_of_clusters = static_cast<int>(clusters.size());
+    std::vector<unsigned int> seeds = std::vector<unsigned int>(number_of_clusters);
+    for (int i = 0; i < number_of_clusters; ++i)
+    {
+        seeds[i] = static_cast<unsigned int>(rand());
+    }
+    std::vector<std::vector<int>> cluster_tours = std::vector<std::vector<int>>(number_of_clusters);
+    parallel_for(0, number_of_clusters, [&](const int& i)
+    {
+        solve_cluster(method, seeds[i], vertices, clusters[i], cluster_tours[i]);
+    });
+
+    std::vector<int> cluster_order;
+    solve_cluster_order(vertices, clusters, cluster_order);
+
+    std::vector<int> junctions;
+    stitch(vertices, cluster_tours, cluster_order, tour, junctions);
+    polish(window_size, vertices, junctions, tour);
+
+    int number_of_vertices = static_cast<int>(tour.size());
+    cost = 0;
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        cost += compute_cost(vertices[tour[i]], vertices[tour[(i + 1) % number_of_vertices]]);
+    }
+}
@@ -0,0 +1,72 @@
+/**
+ * @file decomposition_algorithm.cpp
+ * @author Nguyen Quang <nqoptik@gmail.com>
+ * @brief The hierarchical decomposition algorithm.
+ * @since 0.0.2
+ *
+ * @copyright Copyright (c) 2016, Nguyen Quang, all rights reserved.
+ *
+ */
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include <opencv2/core/core.hpp>
+#include <opencv2/highgui/highgui.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
+
+#include "heuristic_optimisaion/checkpoint.hpp"
+#include "heuristic_optimisaion/common.hpp"
+#include "heuristic_optimisaion/decomposition.hpp"
+#include "heuristic_optimisaion/hilbert_curve.hpp"
+
+int main()
+{
+    int height = 800;
+    int width = 1200;
+    int step_size = 1;
+    int border = 25;
+    int number_of_vertices = 100000;
+    std::vector<std::vector<int>> vertices;
+    generate_vertices("vertices.data", height, width, step_size, border,
+                      number_of_vertices, vertices);
+    bool renumber = true;
+    std::vector<int> original_ids;
+    if (renumber)
+    {
+        renumber_vertices(vertices, original_ids);
+    }
+
+    int method = greedy_method;
+    int cluster_size = 500;
+    int window_size = 50;
+    std::vector<int> decomposition_tour;
+    float decomposition_cost;
+    decomposition(method, cluster_size, window_size, vertices, decomposition_tour, decomposition_cost);
+    std::vector<int> output_tour = decomposition_tour;
+    restore_tour(original_ids, output_tour);
+    save_tour("decomposition_tour.data", output_tour);
+
+    cv::Mat decomposition_map(height, width, CV_8UC3, cv::Scalar(255, 255, 255));
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        cv::line(decomposition_map,
+                 cv::Point(vertices[decomposition_tour[i]][0], vertices[decomposition_tour[i]][1]),
+                 cv::Point(vertices[decomposition_tour[(i + 1) % number_of_vertices]][0],
+                           vertices[decomposition_tour[(i + 1) % number_of_vertices]][1]),
+                 cv::Scalar(255, 0, 0), 1, 8, 0);
+    }
+    std::string decomposition_text = "number_of_vertices = ";
+    decomposition_text.append(std::to_string(number_of_vertices));
+    decomposition_text.append("     decomposition: ");
+    decomposition_text.append(std::to_string(decomposition_cost));
+    cv::putText(decomposition_map, decomposition_text, cv::Point(border, height - border),
+                cv::FONT_HERSHEY_COMPLEX, 1, cv::Scalar(255, 0, 0), 2, 8);
+    cv::imshow("Decomposition", decomposition_map);
+    cv::imwrite("decomposition.png", decomposition_map);
+    cv::waitKey();
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+/**
+ * @file dynamic_algorithm.cpp
+ * @author Nguyen Quang <nqoptik@gmail.com>
+ * @brief The ant algorithm on an instance whose vertices change.
+ * @since 0.0.2
+ *
+ * @copyright Copyright (c) 2016, Nguyen Quang, all rights reserved.
+ *
+ */
+
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include <opencv2/core/core.hpp>
+#include <opencv2/highgui/highgui.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
+
+#include "heuristic_optimisaion/ant.hpp"
+#include "heuristic_optimisaion/checkpoint.hpp"
+#include "heuristic_optimisaion/common.hpp"
+#include "heuristic_optimisaion/dynamic_instance.hpp"
+#include "heuristic_optimisaion/greedy.hpp"
+#include "heuristic_optimisaion/hilbert_curve.hpp"
+
+int main()
+{
+    int height = 800;
+    int width = 1200;
+    int step_size = 8;
+    int border = 25;
+    int number_of_vertices = 100;
+    std::vector<std::vector<int>> vertices;
+    generate_vertices("vertices.data", height, width, step_size, border,
+                      number_of_vertices, vertices);
+    bool renumber = true;
+    std::vector<int> original_ids;
+    if (renumber)
+    {
+        renumber_vertices(vertices, original_ids);
+    }
+    std::vector<std::vector<float>> cost_matrix;
+    compute_cost_matrix("cost_matrix.data", number_of_vertices, vertices, original_ids, cost_matrix);
+
+    int number_of_starts = number_of_vertices;
+    int number_of_tours = 1;
+    std::vector<std::vector<int>> greedy_tours;
+    std::vector<float> greedy_costs;
+    multi_start_greedy(number_of_vertices, number_of_starts, number_of_tours, vertices, cost_matrix,
+                       greedy_tours, greedy_costs);
+
+    int number_of_ants = 100000;
+    float evaporation = 0.8;
+    bool verbose = false;
+    SolverOptions options;
+    std::vector<std::vector<float>> pheromone;
+    std::vector<int> ant_tour;
+    float ant_cost;
+    ant(number_of_vertices, number_of_ants, evaporation, vertices, width, height, border, cost_matrix,
+        greedy_tours[0], pheromone, options, verbose, ant_tour, ant_cost);
+    std::cout << "initial  " << ant_cost << std::endl;
+
+    // Every change is repaired in the cost matrix, the pheromone and the tour
+    // without rebuilding them, and the ant algorithm is re-run from the
+    // repaired state with a few ants only.
+    int number_of_changes = 20;
+    int number_of_ants_per_change = 1000;
+    for (int change = 0; change < number_of_changes; ++change)
+    {
+        std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+        if (change % 2 == 0)
+        {
+            std::vector<int> vertex = std::vector<int>(2);
+            vertex[0] = rand() % ((width - border * 3) / step_size) * step_size + border;
+            vertex[1] = rand() % ((height - border * 3) / step_size) * step_size + border;
+            insert_vertex(vertex, vertices, cost_matrix, original_ids);
+            insert_matrix_vertex(1.0f / static_cast<float>(vertices.size()), pheromone);
+            insert_tour_vertex(static_cast<int>(vertices.size()) - 1, cost_matrix, ant_tour, ant_cost);
+        }
+        else
+        {
+            int vertex_index = rand() % static_cast<int>(vertices.size());
+            int moved_vertex;
+            remove_vertex(vertex_index, vertices, cost_matrix, original_ids, moved_vertex);
+            remove_matrix_vertex(vertex_index, pheromone);
+            remove_tour_vertex(vertex_index, moved_vertex, cost_matrix, ant_tour, ant_cost);
+        }
+        number_of_vertices = static_cast<int>(vertices.size());
+        float repaired_cost = ant_cost;
+        std::vector<int> repaired_tour = ant_tour;
+        ant(number_of_vertices, number_of_ants_per_change, evaporation, vertices, width, height, border,
+            cost_matrix, repaired_tour, pheromone, options, verbose, ant_tour, ant_cost);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        std::cout << "change " << change << "  vertices " << number_of_vertices << "  repaired "
+                  << repaired_cost << "  re-solved " << ant_cost << "  seconds " << seconds << std::endl;
+    }
+
+    // The updated instance is saved in its original numbering, so that the
+    // snapshot warm-starts the next run on dynamic_vertices.data.
+    save_vertices("dynamic_vertices.data", original_ids, vertices);
+    save_ant_state("dynamic_state.bin", original_ids, number_of_ants_per_change, 0, pheromone, ant_tour,
+                   ant_cost);
+    std::vector<int> output_tour = ant_tour;
+    restore_tour(original_ids, output_tour);
+    save_tour("dynamic_tour.data", output_tour);
+
+    cv::Mat dynamic_map(height, width, CV_8UC3, cv::Scalar(255, 255, 255));
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        cv::circle(dynamic_map, cv::Point(vertices[i][0], vertices[i][1]),
+                   1, cv::Scalar(0, 0, 255), 2, 0);
+    }
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        cv::line(dynamic_map,
+                 cv::Point(vertices[ant_tour[i]][0], vertices[ant_tour[i]][1]),
+                 cv::Point(vertices[ant_tour[(i + 1) % number_of_vertices]][0],
+                           vertices[ant_tour[(i + 1) % number_of_vertices]][1]),
+                 cv::Scalar(255, 0, 0), 1, 8, 0);
+    }
+    std::string dynamic_text = "number_of_vertices = ";
+    dynamic_text.append(std::to_string(number_of_vertices));
+    dynamic_text.append("     ant: ");
+    dynamic_text.append(std::to_string(ant_cost));
+    cv::putText(dynamic_map, dynamic_text, cv::Point(border, height - border),
+                cv::FONT_HERSHEY_COMPLEX, 1, cv::Scalar(255, 0, 0), 2, 8);
+    cv::imshow("Dynamic", dynamic_map);
+    cv::imwrite("dynamic.png", dynamic_map);
+    cv::waitKey();
+
+    return 0;
+}
@@ -0,0 +1,210 @@
+/**
+ * @file dynamic_instance.cpp
+ * @author Nguyen Quang <nqoptik@gmail.com>
+ * @brief Incremental updates of instances and solver states when vertices are added or removed.
+ * @since 0.0.2
+ *
+ * @copyright Copyright (c) 2016, Nguyen Quang, all rights reserved.
+ *
+ */
+
+#include "heuristic_optimisaion/dynamic_instance.hpp"
+
+void insert_vertex(const std::vector<int>& vertex,
+                   std::vector<std::vector<int>>& vertices,
+                   std::vector<std::vector<float>>& cost_matrix,
+                   std::vector<int>& original_ids)
+{
+    insert_original_id(original_ids);
+    int number_of_vertices = static_cast<int>(vertices.size());
+    std::vector<float> costs = std::vector<float>(number_of_vertices + 1);
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        costs[i] = compute_cost(vertices[i], vertex);
+        cost_matrix[i].push_back(costs[i]);
+    }
+    costs[number_of_vertices] = FLT_MAX;
+    cost_matrix.push_back(costs);
+    vertices.push_back(vertex);
+}
+
+void remove_vertex(const int& vertex_index,
+                   std::vector<std::vector<int>>& vertices,
+                   std::vector<std::vector<float>>& cost_matrix,
+                   std::vector<int>& original_ids,
+                   int& moved_vertex)
+{
+    remove_original_id(vertex_index, original_ids);
+    int last_vertex = static_cast<int>(vertices.size()) - 1;
+    moved_vertex = vertex_index == last_vertex ? -1 : last_vertex;
+    vertices[vertex_index] = vertices[last_vertex];
+    vertices.pop_back();
+    remove_matrix_vertex(vertex_index, cost_matrix);
+}
+
+void insert_original_id(std::vector<int>& original_ids)
+{
+    if (!original_ids.empty())
+    {
+        original_ids.push_back(static_cast<int>(original_ids.size()));
+    }
+}
+
+void remove_original_id(const int& vertex_index,
+                        std::vector<int>& original_ids)
+{
+    if (original_ids.empty())
+    {
+        return;
+    }
+
+    // The vertex with the last original id takes the original id of the
+    // removed vertex, and the last vertex takes the index of the removed one.
+    int last_vertex = static_cast<int>(original_ids.size()) - 1;
+    for (int i = 0; i <= last_vertex; ++i)
+    {
+        if (original_ids[i] == last_vertex)
+        {
+            original_ids[i] = original_ids[vertex_index];
+            break;
+        }
+    }
+    original_ids[vertex_index] = original_ids[last_vertex];
+    original_ids.pop_back();
+}
+
+void save_vertices(const std::string& file_name,
+                   const std::vector<int>& original_ids,
+                   const std::vector<std::vector<int>>& vertices)
+{
+    int number_of_vertices = static_cast<int>(vertices.size());
+    std::vector<int> order = std::vector<int>(number_of_vertices);
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        order[original_ids.empty() ? i : original_ids[i]] = i;
+    }
+    std::ofstream fs;
+    fs.open(file_name.c_str());
+    fs << number_of_vertices << std::endl;
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        fs << vertices[order[i]][0] << " " << vertices[order[i]][1] << std::endl;
+    }
+    fs.close();
+}
+
+void insert_matrix_vertex(const float& value,
+                          std::vector<std::vector<float>>& matrix)
+{
+    int number_of_vertices = static_cast<int>(matrix.size());
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        matrix[i].push_back(value);
+    }
+    matrix.push_back(std::vector<float>(number_of_vertices + 1, value));
+}
+
+void remove_matrix_vertex(const int& vertex_index,
+                          std::vector<std::vector<float>>& matrix)
+{
+    int last_vertex = static_cast<int>(matrix.size()) - 1;
+    matrix[vertex_index].swap(matrix[last_vertex]);
+    matrix.pop_back();
+    for (int i = 0; i < last_vertex; ++i)
+    {
+        matrix[i][vertex_index] = matrix[i][last_vertex];
+        matrix[i].pop_back();
+    }
+}
+
+void insert_tour_vertex(const int& vertex,
+                        const std::vector<std::vector<float>>& cost_matrix,
+                        std::vector<int>& tour,
+                        float& cost)
+{
+    int tour_size = static_cast<int>(tour.size());
+    if (tour_size < 2)
+    {
+        tour.push_back(vertex);
+        cost = tour_size == 0 ? 0 : 2 * cost_matrix[tour[0]][vertex];
+        return;
+    }
+
+    float min_delta = FLT_MAX;
+    int best_position = 0;
+    for (int i = 0; i < tour_size; ++i)
+    {
+        int from = tour[i];
+        int to = tour[(i + 1) % tour_size];
+        float delta = cost_matrix[from][vertex] + cost_matrix[vertex][to] - cost_matrix[from][to];
+        if (delta < min_delta)
+        {
+            min_delta = delta;
+            best_position = i + 1;
+        }
+    }
+    tour.insert(tour.begin() + best_position, vertex);
+    cost += min_delta;
+}
+
+void remove_tour_vertex(const int& vertex_index,
+                        const int& moved_vertex,
+                        const std::vector<std::vector<float>>& cost_matrix,
+                        std::vector<int>& tour,
+                        float& cost)
+{
+    // The removed vertex has already left the cost matrix, so the cost is
+    // recomputed in the same pass that remaps the moved vertex. A tour without
+    // the removed vertex is only remapped.
+    int position = 0;
+    while (position < static_cast<int>(tour.size()) && tour[position] != vertex_index)
+    {
+        ++position;
+    }
+    if (position < static_cast<int>(tour.size()))
+    {
+        tour.erase(tour.begin() + position);
+    }
+
+    int tour_size = static_cast<int>(tour.size());
+    for (int i = 0; i < tour_size; ++i)
+    {
+        if (tour[i] == moved_vertex)
+        {
+            tour[i] = vertex_index;
+        }
+    }
+    cost = 0;
+    if (tour_size > 1)
+    {
+        for (int i = 0; i < tour_size; ++i)
+        {
+            cost += cost_matrix[tour[i]][tour[(i + 1) % tour_size]];
+        }
+    }
+}
+
+void insert_population_vertex(const int& vertex,
+                              const std::vector<std::vector<float>>& cost_matrix,
+                              std::vector<std::vector<int>>& population,
+                              std::vector<float>& current_costs)
+{
+    current_costs.resize(population.size(), 0);
+    for (size_t i = 0; i < population.size(); ++i)
+    {
+        insert_tour_vertex(vertex, cost_matrix, population[i], current_costs[i]);
+    }
+}
+
+void remove_population_vertex(const int& vertex_index,
+                              const int& moved_vertex,
+                              const std::vector<std::vector<float>>& cost_matrix,
+                              std::vector<std::vector<int>>& population,
+                              std::vector<float>& current_costs)
+{
+    current_costs.resize(population.size(), 0);
+    for (size_t i = 0; i < population.size(); ++i)
+    {
+        remove_tour_vertex(vertex_index, moved_vertex, cost_matrix, population[i], current_costs[i]);
+    }
+}
@@ -0,0 +1,418 @@
+/**
+ * @file genetic.cpp
+ * @author Nguyen Quang <nqoptik@gmail.com>
+ * @brief The genetic algorithm.
+ * @since 0.0.1
+ * 
+ * @copyright Copyright (c) 2016, Nguyen Quang, all rights reserved.
+ * 
+ */
+
+#include "heuristic_optimisaion/checkpoint.hpp"
+#include "heuristic_optimisaion/common.hpp"
+#include "heuristic_optimisaion/genetic.hpp"
+#include "heuristic_optimisaion/greedy.hpp"
+
+void genetic(const int& number_of_vertices,
+             const int& population_size,
+             const int& hybridization_size,
+             const int& mutation_size,
+             const int& number_of_generations,
+             const float& seeding_fraction,
+             const std::vector<std::vector<float>>& cost_matrix,
+             const std::vector<std::vector<int>>& initial_tours,
+             const SolverOptions& options,
+             std::vector<int>& tour,
+             float& cost)
+{
+    std::vector<std::vector<int>> population = std::vector<std::vector<int>>(population_size + hybridization_size * 2 + mutation_size);
+    initialise(number_of_vertices, population_size, seeding_fraction, cost_matrix, population);
+
+    // A snapshot of an unfinished run is resumed as it is, a snapshot of a
+    // finished run only warm-starts the population. Supplied tours are seeded
+    // in front of the loaded population, so that they are never dropped.
+    int first_generation = 0;
+    std::vector<std::vector<int>> loaded_population;
+    std::vector<float> current_costs;
+    bool is_resumed = false;
+    if (!options.state_file_name.empty() &&
+        load_genetic_state(options.state_file_name, options.original_ids, number_of_vertices, first_generation,
+                           loaded_population, current_costs))
+    {
+        if (first_generation >= number_of_generations)
+        {
+            first_generation = 0;
+        }
+        else
+        {
+            is_resumed = true;
+        }
+        std::cout << "Loaded " << options.state_file_name << " at generation " << first_generation << std::endl;
+    }
+    std::vector<std::vector<int>> seeds;
+    for (size_t i = 0; i < initial_tours.size() && !is_resumed; ++i)
+    {
+        if (is_valid_tour(number_of_vertices, initial_tours[i]))
+        {
+            seeds.push_back(initial_tours[i]);
+        }
+    }
+    seeds.insert(seeds.end(), loaded_population.begin(), loaded_population.end());
+    for (int i = 0; i < static_cast<int>(seeds.size()) && i < population_size; ++i)
+    {
+        population[i] = seeds[i];
+    }
+
+    // The parents keep their costs and hashes from one generation to the next,
+    // so only the offspring are evaluated.
+    int current_population_size = population_size + 2 * hybridization_size + mutation_size;
+    current_costs = std::vector<float>(current_population_size);
+    std::vector<unsigned long long> hashes = std::vector<unsigned long long>(current_population_size);
+    std::unordered_map<unsigned long long, float> fitness_cache;
+    evaluate(number_of_vertices, 0, population_size, cost_matrix, population, current_costs, hashes,
+             fitness_cache);
+
+    cost = FLT_MAX;
+    for (int generation = first_generation; generation < number_of_generations; ++generation)
+    {
+        for (int i = 0; i < hybridization_size; ++i)
+        {
+            int first_individual_index = random_number() % population_size;
+            int second_individual_index = random_number() % population_size;
+            int from = random_number() % number_of_vertices;
+            int to = random_number() % number_of_vertices;
+            std::vector<int> tour_1_, tour_2_;
+            hybridise(number_of_vertices, population[first_individual_index],
+                      population[second_individual_index],
+                      tour_1_,
+                      tour_2_, from, to);
+
+            population[population_size + 2 * i] = tour_1_;
+            population[population_size + 2 * i + 1] = tour_2_;
+        }
+
+        for (int i = 0; i < mutation_size; ++i)
+        {
+            int individual_index = random_number() % population_size;
+            int method = random_number() % 3;
+            int from = random_number() % number_of_vertices;
+            int to = random_number() % number_of_vertices;
+
+            std::vector<int> tour_;
+            mutate(number_of_vertices, population[individual_index],
+                   tour_, method,
+                   from, to);
+
+            population[population_size + 2 * hybridization_size + i] = tour_;
+        }
+
+        evaluate(number_of_vertices, population_size, current_population_size, cost_matrix, population,
+                 current_costs, hashes, fitness_cache);
+        select(population_size, hybridization_size, mutation_size, population, current_costs, hashes);
+        cost = current_costs[0];
+
+        if (!options.state_file_name.empty() && options.checkpoint_interval > 0 &&
+            (generation + 1) % options.checkpoint_interval == 0)
+        {
+            save_genetic_state(options.state_file_name, options.original_ids, generation + 1, population,
+                               current_costs);
+        }
+        if (options.lower_bound > 0 && cost <= options.lower_bound * (1 + options.target_gap))
+        {
+            break;
+        }
+    }
+    if (!options.state_file_name.empty())
+    {
+        save_genetic_state(options.state_file_name, options.original_ids, number_of_generations, population,
+                           current_costs);
+    }
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        tour.push_back(population[0][i]);
+    }
+}
+
+void initialise(const int& number_of_vertices,
+                const int& population_size,
+                const float& seeding_fraction,
+                const std::vector<std::vector<float>>& cost_matrix,
+                std::vector<std::vector<int>>& population)
+{
+    // Only the parents are built, the offspring slots are overwritten by
+    // hybridise() and mutate() before they are ever selected. The first
+    // individuals are nearest-neighbour tours from evenly spread start vertices.
+    int number_of_seeded_individuals = static_cast<int>(seeding_fraction * population_size);
+    if (number_of_seeded_individuals > number_of_vertices)
+    {
+        number_of_seeded_individuals = number_of_vertices;
+    }
+
+    std::vector<unsigned int> seeds = std::vector<unsigned int>(population_size);
+    for (int i = 0; i < population_size; ++i)
+    {
+        seeds[i] = static_cast<unsigned int>(random_number());
+    }
+
+    // The candidate lists are computed once for all seeded individuals.
+    int number_of_candidates = 16;
+    std::vector<std::vector<int>> candidates;
+    if (number_of_seeded_individuals > 0)
+    {
+        compute_candidates(number_of_vertices, number_of_candidates, cost_matrix, candidates);
+    }
+
+    parallel_for(0, population_size, [&](const int& i)
+    {
+        if (i < number_of_seeded_individuals)
+        {
+            int start = static_cast<int>(static_cast<long long>(i) * number_of_vertices / number_of_seeded_individuals);
+            float seeded_cost;
+            candidate_greedy(number_of_vertices, start, candidates, cost_matrix, population[i], seeded_cost);
+        }
+        else
+        {
+            population[i] = std::vector<int>(number_of_vertices);
+            for (int j = 0; j < number_of_vertices; ++j)
+            {
+                population[i][j] = j;
+            }
+            std::minstd_rand generator(seeds[i]);
+            std::shuffle(population[i].begin(), population[i].end(), generator);
+        }
+    });
+}
+
+void hybridise(const int& number_of_vertices,
+               const std::vector<int>& tour_1,
+               const std::vector<int>& tour_2,
+               std::vector<int>& tour_1_,
+               std::vector<int>& tour_2_,
+               const int& from,
+               const int& to)
+{
+    tour_1_ = std::vector<int>(number_of_vertices);
+    tour_2_ = std::vector<int>(number_of_vertices);
+    std::vector<bool> is_mixing_strand = std::vector<bool>(number_of_vertices, false);
+    std::vector<int> check_tour_1 = std::vector<int>(number_of_vertices, 0);
+    std::vector<int> check_tour_2 = std::vector<int>(number_of_vertices, 0);
+
+    if (from < to)
+    {
+        for (int i = from; i <= to; ++i)
+        {
+            is_mixing_strand[i] = true;
+        }
+    }
+    else
+    {
+        for (int i = to; i <= from; ++i)
+        {
+            is_mixing_strand[i] = true;
+        }
+    }
+
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        if (is_mixing_strand[i] == true)
+        {
+            tour_1_[i] = tour_2[i];
+            tour_2_[i] = tour_1[i];
+            for (int j = 0; j < number_of_vertices; ++j)
+            {
+                if (tour_1[j] == tour_2[i])
+                {
+                    check_tour_1[j] = 1;
+                }
+                if (tour_2[j] == tour_1[i])
+                {
+                    check_tour_2[j] = 1;
+                }
+            }
+        }
+    }
+
+    int current_index_1 = 0;
+    int current_index_2 = 0;
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        while (check_tour_1[current_index_1] == 1)
+        {
+            ++current_index_1;
+        }
+        while (check_tour_2[current_index_2] == 1)
+        {
+            ++current_index_2;
+        }
+        if (is_mixing_strand[i] == false)
+        {
+            tour_1_[i] = tour_1[current_index_1];
+            tour_2_[i] = tour_2[current_index_2];
+            ++current_index_1;
+            ++current_index_2;
+        }
+    }
+}
+
+void mutate(const int& number_of_vertices,
+            const std::vector<int>& tour,
+            std::vector<int>& tour_,
+            const int& method,
+            int& from,
+            int& to)
+{
+    tour_ = std::vector<int>(number_of_vertices);
+
+    if (from > to)
+    {
+        int temp = to;
+        to = from;
+        from = temp;
+    }
+
+    if (method == 0)
+    {
+        for (int i = 0; i < number_of_vertices; ++i)
+        {
+            tour_[i] = tour[i];
+        }
+        tour_[from] = tour[to];
+        tour_[to] = tour[from];
+    }
+    else if (method == 1)
+    {
+        for (int i = 0; i < from; ++i)
+        {
+            tour_[i] = tour[i];
+        }
+        for (int i = from; i <= to; ++i)
+        {
+            tour_[i] = tour[from + to - i];
+        }
+        for (int i = to + 1; i < number_of_vertices; ++i)
+        {
+            tour_[i] = tour[i];
+        }
+    }
+    else
+    {
+        for (int i = 0; i < from; ++i)
+        {
+            tour_[i] = tour[i];
+        }
+        for (int i = from; i < from + (number_of_vertices - (to + 1)); ++i)
+        {
+            tour_[i] = tour[i + to - from + 1];
+        }
+        for (int i = from + (number_of_vertices - (to + 1)); i < number_of_vertices; ++i)
+        {
+            tour_[i] = tour[i - (number_of_vertices - (to + 1))];
+        }
+    }
+}
+
+static unsigned long long hash_edge(const int& from,
+                                    const int& to)
+{
+    unsigned long long key = from < to ? (static_cast<unsigned long long>(from) << 32) | to
+                                       : (static_cast<unsigned long long>(to) << 32) | from;
+    key += 0x9e3779b97f4a7c15ULL;
+    key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    key = (key ^ (key >> 27)) * 0x94d049bb133111ebULL;
+    return key ^ (key >> 31);
+}
+
+unsigned long long hash_tour(const int& number_of_vertices,
+                             const std::vector<int>& tour)
+{
+    unsigned long long hash = 0;
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        hash ^= hash_edge(tour[i], tour[(i + 1) % number_of_vertices]);
+    }
+    return hash;
+}
+
+void evaluate(const int& number_of_vertices,
+              const int& from,
+              const int& to,
+              const std::vector<std::vector<float>>& cost_matrix,
+              const std::vector<std::vector<int>>& population,
+              std::vector<float>& current_costs,
+              std::vector<unsigned long long>& hashes,
+              std::unordered_map<unsigned long long, float>& fitness_cache)
+{
+    // The cache is simply emptied once it outgrows a few populations, the
+    // recent tours are the ones that are generated again.
+    if (fitness_cache.size() > 16 * current_costs.size())
+    {
+        fitness_cache.clear();
+    }
+
+    for (int i = from; i < to; ++i)
+    {
+        hashes[i] = hash_tour(number_of_vertices, population[i]);
+        std::unordered_map<unsigned long long, float>::const_iterator cached = fitness_cache.find(hashes[i]);
+        if (cached != fitness_cache.end())
+        {
+            current_costs[i] = cached->second;
+            continue;
+        }
+
+        float current_cost = 0;
+        for (int j = 0; j < number_of_vertices; ++j)
+        {
+            current_cost += cost_matrix[population[i][j]][population[i][(j + 1) % number_of_vertices]];
+        }
+        current_costs[i] = current_cost;
+        fitness_cache[hashes[i]] = current_cost;
+    }
+}
+
+void select(const int& population_size,
+            const int& hybridization_size,
+            const int& mutation_size,
+            std::vector<std::vector<int>>& population,
+            std::vector<float>& current_costs,
+            std::vector<unsigned long long>& hashes)
+{
+    int current_population_size = population_size + 2 * hybridization_size + mutation_size;
+    std::vector<int> order = std::vector<int>(current_population_size);
+    for (int i = 0; i < current_population_size; ++i)
+    {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](const int& a, const int& b)
+                     { return current_costs[a] < current_costs[b]; });
+
+    // Copies of a tour already selected are moved behind the distinct tours,
+    // and only survive when there are not enough distinct tours.
+    std::vector<int> distinct_order;
+    std::vector<int> duplicate_order;
+    std::unordered_set<unsigned long long> distinct_hashes;
+    for (int i = 0; i < current_population_size; ++i)
+    {
+        if (distinct_hashes.insert(hashes[order[i]]).second)
+        {
+            distinct_order.push_back(order[i]);
+        }
+        else
+        {
+            duplicate_order.push_back(order[i]);
+        }
+    }
+    distinct_order.insert(distinct_order.end(), duplicate_order.begin(), duplicate_order.end());
+
+    std::vector<std::vector<int>> selected_population = std::vector<std::vector<int>>(current_population_size);
+    std::vector<float> selected_costs = std::vector<float>(current_population_size);
+    std::vector<unsigned long long> selected_hashes = std::vector<unsigned long long>(current_population_size);
+    for (int i = 0; i < current_population_size; ++i)
+    {
+        selected_population[i].swap(population[distinct_order[i]]);
+        selected_costs[i] = current_costs[distinct_order[i]];
+        selected_hashes[i] = hashes[distinct_order[i]];
+    }
+    population.swap(selected_population);
+    current_costs.swap(selected_costs);
+    hashes.swap(selected_hashes);
+}
@@ -0,0 +1,380 @@
+/**
+ * @file greedy.cpp
+ * @author Nguyen Quang <nqoptik@gmail.com>
+ * @brief The greedy algorithm.
+ * @since 0.0.1
+ * 
+ * @copyright Copyright (c) 2016, Nguyen Quang, all rights reserved.
+ * 
+ */
+
+#include "heuristic_optimisaion/greedy.hpp"
+
+void greedy(const int& number_of_vertices,
+            const int& start,
+            const std::vector<std::vector<float>>& cost_matrix,
+            std::vector<int>& tour,
+            float& cost)
+{
+    std::vector<bool> has_been_visited = std::vector<bool>(number_of_vertices, false);
+    tour = std::vector<int>(number_of_vertices);
+    tour[0] = start;
+    has_been_visited[start] = true;
+    int current_vertex = start;
+    cost = 0;
+    for (int step = 1; step < number_of_vertices; ++step)
+    {
+        float min_cost = FLT_MAX;
+        int nearest_vertex = 0;
+        for (int next_vertex = 0; next_vertex < number_of_vertices; ++next_vertex)
+        {
+            if (min_cost > cost_matrix[current_vertex][next_vertex] &&
+                has_been_visited[next_vertex] == false)
+            {
+                min_cost = cost_matrix[current_vertex][next_vertex];
+                nearest_vertex = next_vertex;
+            }
+        }
+        tour[step] = nearest_vertex;
+        has_been_visited[nearest_vertex] = true;
+        current_vertex = nearest_vertex;
+        cost += min_cost;
+    }
+    cost += cost_matrix[tour[number_of_vertices - 1]][start];
+}
+
+// A uniform grid over the vertices with about two vertices per cell. The
+// vertices are sorted by cell, so that the vertices of cell c are
+// cell_vertices[cell_begins[c]] to cell_vertices[cell_begins[c + 1] - 1].
+// The coordinates are copied into one array, x then y of every vertex, which
+// stays in cache where the rows of the cost matrix do not.
+struct VertexGrid
+{
+    int min_x;
+    int min_y;
+    float cell_size;
+    int number_of_columns;
+    int number_of_rows;
+    std::vector<int> coordinates;
+    std::vector<int> vertex_cells;
+    std::vector<int> cell_begins;
+    std::vector<int> cell_vertices;
+};
+
+static void build_vertex_grid(const std::vector<std::vector<int>>& vertices,
+                              VertexGrid& grid)
+{
+    int number_of_vertices = static_cast<int>(vertices.size());
+    int min_x = INT_MAX;
+    int min_y = INT_MAX;
+    int max_x = INT_MIN;
+    int max_y = INT_MIN;
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        min_x = std::min(min_x, vertices[i][0]);
+        min_y = std::min(min_y, vertices[i][1]);
+        max_x = std::max(max_x, vertices[i][0]);
+        max_y = std::max(max_y, vertices[i][1]);
+    }
+    float area = static_cast<float>(max_x - min_x + 1) * static_cast<float>(max_y - min_y + 1);
+    grid.min_x = min_x;
+    grid.min_y = min_y;
+    grid.cell_size = std::max(1.0f, std::sqrt(2 * area / static_cast<float>(number_of_vertices)));
+    grid.number_of_columns = static_cast<int>((max_x - min_x) / grid.cell_size) + 1;
+    grid.number_of_rows = static_cast<int>((max_y - min_y) / grid.cell_size) + 1;
+
+    int number_of_cells = grid.number_of_columns * grid.number_of_rows;
+    grid.coordinates = std::vector<int>(2 * number_of_vertices);
+    grid.vertex_cells = std::vector<int>(number_of_vertices);
+    grid.cell_begins = std::vector<int>(number_of_cells + 1, 0);
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        int column = static_cast<int>((vertices[i][0] - min_x) / grid.cell_size);
+        int row = static_cast<int>((vertices[i][1] - min_y) / grid.cell_size);
+        grid.coordinates[2 * i] = vertices[i][0];
+        grid.coordinates[2 * i + 1] = vertices[i][1];
+        grid.vertex_cells[i] = row * grid.number_of_columns + column;
+        ++grid.cell_begins[grid.vertex_cells[i] + 1];
+    }
+    for (int c = 0; c < number_of_cells; ++c)
+    {
+        grid.cell_begins[c + 1] += grid.cell_begins[c];
+    }
+    grid.cell_vertices = std::vector<int>(number_of_vertices);
+    std::vector<int> cell_ends = std::vector<int>(grid.cell_begins.begin(), grid.cell_begins.end() - 1);
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        grid.cell_vertices[cell_ends[grid.vertex_cells[i]]++] = i;
+    }
+}
+
+// Builds the nearest-neighbour tour from start. The first unvisited vertex in
+// the candidate list is the nearest unvisited vertex, so the unvisited
+// vertices are only searched once all candidates are visited. With a grid the
+// search visits the cells in rings around the current vertex, and stops once
+// no vertex beyond the ring can be nearer, which assumes that the costs are
+// the distances between the vertices. Without a grid the unvisited vertices
+// are scanned from a packed list, so that a scan only touches the vertices
+// that are left. candidate_costs, if not empty, holds the costs to the
+// candidates, so that most steps do not read the cost matrix. The
+// construction is abandoned, and false returned, as soon as
+// should_abort(cost, vertex) holds after a vertex is appended.
+template <typename ShouldAbort>
+static bool build_candidate_tour(const int& number_of_vertices,
+                                 const int& start,
+                                 const std::vector<std::vector<int>>& candidates,
+                                 const std::vector<std::vector<float>>& candidate_costs,
+                                 const VertexGrid* grid,
+                                 const std::vector<std::vector<float>>& cost_matrix,
+                                 const ShouldAbort& should_abort,
+                                 std::vector<int>& tour,
+                                 float& cost)
+{
+    std::vector<bool> has_been_visited = std::vector<bool>(number_of_vertices, false);
+    std::vector<int> unvisited_vertices;
+    std::vector<int> unvisited_positions = std::vector<int>(number_of_vertices);
+    std::vector<int> cell_sizes;
+    if (grid == nullptr)
+    {
+        unvisited_vertices = std::vector<int>(number_of_vertices);
+        for (int j = 0; j < number_of_vertices; ++j)
+        {
+            unvisited_vertices[j] = j;
+            unvisited_positions[j] = j;
+        }
+    }
+    else
+    {
+        // The unvisited vertices of a cell are packed at its front.
+        unvisited_vertices = grid->cell_vertices;
+        for (int j = 0; j < number_of_vertices; ++j)
+        {
+            unvisited_positions[unvisited_vertices[j]] = j;
+        }
+        cell_sizes = std::vector<int>(grid->cell_begins.size() - 1);
+        for (size_t c = 0; c < cell_sizes.size(); ++c)
+        {
+            cell_sizes[c] = grid->cell_begins[c + 1] - grid->cell_begins[c];
+        }
+    }
+    int number_of_unvisited_vertices = number_of_vertices;
+    auto visit = [&](const int& vertex)
+    {
+        has_been_visited[vertex] = true;
+        int last_position = grid == nullptr ? --number_of_unvisited_vertices
+                                            : grid->cell_begins[grid->vertex_cells[vertex]] +
+                                                  --cell_sizes[grid->vertex_cells[vertex]];
+        int last_vertex = unvisited_vertices[last_position];
+        unvisited_vertices[unvisited_positions[vertex]] = last_vertex;
+        unvisited_positions[last_vertex] = unvisited_positions[vertex];
+    };
+    auto search_grid = [&](const int& current_vertex, int& nearest_vertex)
+    {
+        int x = grid->coordinates[2 * current_vertex];
+        int y = grid->coordinates[2 * current_vertex + 1];
+        int min_squared_distance = INT_MAX;
+        int column = grid->vertex_cells[current_vertex] % grid->number_of_columns;
+        int row = grid->vertex_cells[current_vertex] / grid->number_of_columns;
+        int max_ring = std::max(std::max(column, grid->number_of_columns - 1 - column),
+                                std::max(row, grid->number_of_rows - 1 - row));
+        for (int ring = 0; ring <= max_ring; ++ring)
+        {
+            for (int r = std::max(0, row - ring); r <= std::min(grid->number_of_rows - 1, row + ring); ++r)
+            {
+                bool is_edge_row = r == row - ring || r == row + ring;
+                int step = is_edge_row || ring == 0 ? 1 : 2 * ring;
+                for (int c = column - ring; c <= column + ring; c += step)
+                {
+                    if (c < 0 || c >= grid->number_of_columns)
+                    {
+                        continue;
+                    }
+                    int cell = r * grid->number_of_columns + c;
+                    for (int j = grid->cell_begins[cell]; j < grid->cell_begins[cell] + cell_sizes[cell]; ++j)
+                    {
+                        int next_vertex = unvisited_vertices[j];
+                        int dx = grid->coordinates[2 * next_vertex] - x;
+                        int dy = grid->coordinates[2 * next_vertex + 1] - y;
+                        if (min_squared_distance > dx * dx + dy * dy)
+                        {
+                            min_squared_distance = dx * dx + dy * dy;
+                            nearest_vertex = next_vertex;
+                        }
+                    }
+                }
+            }
+            float ring_distance = ring * grid->cell_size;
+            if (min_squared_distance <= ring_distance * ring_distance)
+            {
+                return;
+            }
+        }
+    };
+
+    tour = std::vector<int>(number_of_vertices);
+    tour[0] = start;
+    visit(start);
+    int current_vertex = start;
+    cost = 0;
+    for (int step = 1; step < number_of_vertices; ++step)
+    {
+        int nearest_vertex = -1;
+        float step_cost = 0;
+        for (size_t j = 0; j < candidates[current_vertex].size(); ++j)
+        {
+            if (has_been_visited[candidates[current_vertex][j]] == false)
+            {
+                nearest_vertex = candidates[current_vertex][j];
+                step_cost = candidate_costs.empty() ? cost_matrix[current_vertex][nearest_vertex]
+                                                    : candidate_costs[current_vertex][j];
+                break;
+            }
+        }
+        if (nearest_vertex == -1 && grid != nullptr)
+        {
+            search_grid(current_vertex, nearest_vertex);
+            step_cost = cost_matrix[current_vertex][nearest_vertex];
+        }
+        else if (nearest_vertex == -1)
+        {
+            step_cost = FLT_MAX;
+            for (int j = 0; j < number_of_unvisited_vertices; ++j)
+            {
+                int next_vertex = unvisited_vertices[j];
+                if (step_cost > cost_matrix[current_vertex][next_vertex])
+                {
+                    step_cost = cost_matrix[current_vertex][next_vertex];
+                    nearest_vertex = next_vertex;
+                }
+            }
+        }
+        cost += step_cost;
+        if (should_abort(cost, nearest_vertex))
+        {
+            return false;
+        }
+        tour[step] = nearest_vertex;
+        visit(nearest_vertex);
+        current_vertex = nearest_vertex;
+    }
+    if (number_of_vertices > 1)
+    {
+        cost += cost_matrix[tour[number_of_vertices - 1]][start];
+    }
+    return true;
+}
+
+void candidate_greedy(const int& number_of_vertices,
+                      const int& start,
+                      const std::vector<std::vector<int>>& candidates,
+                      const std::vector<std::vector<float>>& cost_matrix,
+                      std::vector<int>& tour,
+                      float& cost)
+{
+    build_candidate_tour(number_of_vertices, start, candidates, std::vector<std::vector<float>>(), nullptr,
+                         cost_matrix,
+                         [](const float&, const int&)
+                         { return false; },
+                         tour, cost);
+}
+
+void multi_start_greedy(const int& number_of_vertices,
+                        const int& number_of_starts,
+                        const int& number_of_tours,
+                        const std::vector<std::vector<int>>& vertices,
+                        const std::vector<std::vector<float>>& cost_matrix,
+                        std::vector<std::vector<int>>& tours,
+                        std::vector<float>& costs)
+{
+    tours.clear();
+    costs.clear();
+    int start_count = std::min(number_of_starts, number_of_vertices);
+    if (start_count <= 0 || number_of_tours <= 0)
+    {
+        return;
+    }
+
+    int number_of_candidates = 16;
+    std::vector<std::vector<int>> candidates;
+    compute_candidates(number_of_vertices, number_of_candidates, cost_matrix, candidates);
+
+    VertexGrid grid;
+    bool has_grid = static_cast<int>(vertices.size()) == number_of_vertices;
+    if (has_grid)
+    {
+        build_vertex_grid(vertices, grid);
+    }
+
+    // The rest of a tour is a path from the current vertex through the
+    // unvisited vertices back to the start. Every unvisited vertex has two
+    // edges on it, no cheaper than the costs to its two nearest neighbours,
+    // and the ends have one each, no cheaper than the cost to their nearest
+    // neighbour. Every edge has two ends, so half of the sum of these costs
+    // plus the partial cost bounds the final cost.
+    std::vector<std::vector<float>> candidate_costs = std::vector<std::vector<float>>(number_of_vertices);
+    std::vector<double> nearest_costs = std::vector<double>(number_of_vertices, 0);
+    std::vector<double> two_nearest_costs = std::vector<double>(number_of_vertices, 0);
+    double two_nearest_cost_sum = 0;
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        candidate_costs[i] = std::vector<float>(candidates[i].size());
+        for (size_t j = 0; j < candidates[i].size(); ++j)
+        {
+            candidate_costs[i][j] = cost_matrix[i][candidates[i][j]];
+        }
+        if (!candidates[i].empty())
+        {
+            nearest_costs[i] = candidate_costs[i][0];
+            two_nearest_costs[i] = nearest_costs[i] + candidate_costs[i][std::min<size_t>(1, candidates[i].size() - 1)];
+        }
+        two_nearest_cost_sum += two_nearest_costs[i];
+    }
+
+    std::mutex best_tours_mutex;
+    std::vector<std::pair<float, std::vector<int>>> best_tours;
+    std::atomic<float> abort_cost(FLT_MAX);
+    parallel_for(0, start_count, [&](const int& i)
+    {
+        int start = static_cast<int>(static_cast<long long>(i) * number_of_vertices / start_count);
+
+        double unvisited_cost_sum = two_nearest_cost_sum - two_nearest_costs[start];
+        std::vector<int> tour;
+        float cost;
+        if (!build_candidate_tour(number_of_vertices, start, candidates, candidate_costs, has_grid ? &grid : nullptr,
+                                  cost_matrix,
+                                  [&](const float& partial_cost, const int& vertex)
+                                  {
+                                      unvisited_cost_sum -= two_nearest_costs[vertex];
+                                      double remaining_cost =
+                                          (unvisited_cost_sum + nearest_costs[vertex] + nearest_costs[start]) / 2;
+                                      return partial_cost + remaining_cost >
+                                             abort_cost.load(std::memory_order_relaxed);
+                                  },
+                                  tour, cost))
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(best_tours_mutex);
+        if (cost >= abort_cost.load())
+        {
+            return;
+        }
+        best_tours.push_back(std::make_pair(cost, tour));
+        std::sort(best_tours.begin(), best_tours.end());
+        if (static_cast<int>(best_tours.size()) > number_of_tours)
+        {
+            best_tours.pop_back();
+        }
+        if (static_cast<int>(best_tours.size()) == number_of_tours)
+        {
+            abort_cost.store(best_tours.back().first);
+        }
+    });
+
+    for (size_t i = 0; i < best_tours.size(); ++i)
+    {
+        costs.push_back(best_tours[i].first);
+        tours.push_back(best_tours[i].second);
+    }
+}
@@ -17,13 +17,10 @@
 #include <opencv2/highgui/highgui.hpp>
 #include <opencv2/imgproc/imgproc.hpp>
 
+#include "heuristic_optimisaion/checkpoint.hpp"
 #include "heuristic_optimisaion/common.hpp"
-
-void greedy(const int& number_of_vertices,
-            const int& start,
-            const std::vector<std::vector<float>>& cost_matrix,
-            std::vector<int>& tour,
-            float& cost);
+#include "heuristic_optimisaion/greedy.hpp"
+#include "heuristic_optimisaion/hilbert_curve.hpp"
 
 int main()
 {
@@ -35,13 +32,26 @@ int main()
     std::vector<std::vector<int>> vertices;
     generate_vertices("vertices.data", height, width, step_size, border,
                       number_of_vertices, vertices);
+    bool renumber = true;
+    std::vector<int> original_ids;
+    if (renumber)
+    {
+        renumber_vertices(vertices, original_ids);
+    }
     std::vector<std::vector<float>> cost_matrix;
-    compute_cost_matrix("cost_matrix.data", number_of_vertices, vertices, cost_matrix);
+    compute_cost_matrix("cost_matrix.data", number_of_vertices, vertices, original_ids, cost_matrix);
 
-    int start = 0;
-    std::vector<int> greedy_tour;
-    float greedy_cost;
-    greedy(number_of_vertices, start, cost_matrix, greedy_tour, greedy_cost);
+    int number_of_starts = number_of_vertices;
+    int number_of_tours = 1;
+    std::vector<std::vector<int>> greedy_tours;
+    std::vector<float> greedy_costs;
+    multi_start_greedy(number_of_vertices, number_of_starts, number_of_tours, vertices, cost_matrix,
+                       greedy_tours, greedy_costs);
+    std::vector<int> greedy_tour = greedy_tours[0];
+    float greedy_cost = greedy_costs[0];
+    std::vector<int> output_tour = greedy_tour;
+    restore_tour(original_ids, output_tour);
+    save_tour("greedy_tour.data", output_tour);
     cv::Mat greedy_map(height, width, CV_8UC3, cv::Scalar(255, 255, 255));
     for (int i = 0; i < number_of_vertices; ++i)
     {
@@ -71,36 +81,3 @@ int main()
 
     return 0;
 }
-
-void greedy(const int& number_of_vertices,
-            const int& start,
-            const std::vector<std::vector<float>>& cost_matrix,
-            std::vector<int>& tour,
-            float& cost)
-{
-    std::vector<bool> has_been_visited = std::vector<bool>(number_of_vertices, false);
-    tour = std::vector<int>(number_of_vertices);
-    tour[0] = start;
-    has_been_visited[start] = true;
-    int current_vertex = start;
-    cost = 0;
-    for (int step = 1; step < number_of_vertices; ++step)
-    {
-        float min_cost = FLT_MAX;
-        int nearest_vertex = 0;
-        for (int next_vertex = 0; next_vertex < number_of_vertices; ++next_vertex)
-        {
-            if (min_cost > cost_matrix[current_vertex][next_vertex] &&
-                has_been_visited[next_vertex] == false)
-            {
-                min_cost = cost_matrix[current_vertex][next_vertex];
-                nearest_vertex = next_vertex;
-            }
-        }
-        tour[step] = nearest_vertex;
-        has_been_visited[nearest_vertex] = true;
-        current_vertex = nearest_vertex;
-        cost += min_cost;
-    }
-    cost += cost_matrix[tour[number_of_vertices - 1]][start];
-}
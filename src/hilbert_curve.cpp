@@ -0,0 +1,114 @@
+/**
+ * @file hilbert_curve.cpp
+ * @author Nguyen Quang <nqoptik@gmail.com>
+ * @brief Ordering of vertices along a Hilbert curve.
+ * @since 0.0.2
+ *
+ * @copyright Copyright (c) 2016, Nguyen Quang, all rights reserved.
+ *
+ */
+
+#include "heuristic_optimisaion/hilbert_curve.hpp"
+
+static const int hilbert_side = 1 << 16;
+
+long long hilbert_index(const int& x,
+                        const int& y)
+{
+    long long index = 0;
+    int rotated_x = x;
+    int rotated_y = y;
+    for (int side = hilbert_side / 2; side > 0; side /= 2)
+    {
+        int quadrant_x = (rotated_x & side) > 0 ? 1 : 0;
+        int quadrant_y = (rotated_y & side) > 0 ? 1 : 0;
+        index += static_cast<long long>(side) * side * ((3 * quadrant_x) ^ quadrant_y);
+        if (quadrant_y == 0)
+        {
+            if (quadrant_x == 1)
+            {
+                rotated_x = hilbert_side - 1 - rotated_x;
+                rotated_y = hilbert_side - 1 - rotated_y;
+            }
+            int temporary = rotated_x;
+            rotated_x = rotated_y;
+            rotated_y = temporary;
+        }
+    }
+    return index;
+}
+
+void compute_hilbert_order(const std::vector<std::vector<int>>& vertices,
+                           std::vector<int>& order)
+{
+    int number_of_vertices = static_cast<int>(vertices.size());
+    order = std::vector<int>(number_of_vertices);
+    if (number_of_vertices == 0)
+    {
+        return;
+    }
+
+    int min_x = vertices[0][0];
+    int min_y = vertices[0][1];
+    for (int i = 1; i < number_of_vertices; ++i)
+    {
+        min_x = std::min(min_x, vertices[i][0]);
+        min_y = std::min(min_y, vertices[i][1]);
+    }
+
+    std::vector<std::pair<long long, int>> keys = std::vector<std::pair<long long, int>>(number_of_vertices);
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        keys[i] = std::make_pair(hilbert_index(vertices[i][0] - min_x, vertices[i][1] - min_y), i);
+    }
+    std::sort(keys.begin(), keys.end());
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        order[i] = keys[i].second;
+    }
+}
+
+void renumber_vertices(std::vector<std::vector<int>>& vertices,
+                       std::vector<int>& original_ids)
+{
+    compute_hilbert_order(vertices, original_ids);
+    int number_of_vertices = static_cast<int>(vertices.size());
+    std::vector<std::vector<int>> renumbered_vertices = std::vector<std::vector<int>>(number_of_vertices);
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        renumbered_vertices[i].swap(vertices[original_ids[i]]);
+    }
+    vertices.swap(renumbered_vertices);
+}
+
+void renumber_tour(const std::vector<int>& original_ids,
+                   std::vector<int>& tour)
+{
+    if (original_ids.empty())
+    {
+        return;
+    }
+    int number_of_vertices = static_cast<int>(original_ids.size());
+    std::vector<int> new_ids = std::vector<int>(number_of_vertices);
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        new_ids[original_ids[i]] = i;
+    }
+    for (size_t i = 0; i < tour.size(); ++i)
+    {
+        tour[i] = new_ids[tour[i]];
+    }
+}
+
+void restore_tour(const std::vector<int>& original_ids,
+                  std::vector<int>& tour)
+{
+    if (original_ids.empty())
+    {
+        return;
+    }
+    for (size_t i = 0; i < tour.size(); ++i)
+    {
+        tour[i] = original_ids[tour[i]];
+    }
+}
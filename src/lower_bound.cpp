@@ -0,0 +1,242 @@
+/**
+ * @file lower_bound.cpp
+ * @author Nguyen Quang <nqoptik@gmail.com>
+ * @brief The Held-Karp lower bound of tour costs.
+ * @since 0.0.2
+ *
+ * @copyright Copyright (c) 2016, Nguyen Quang, all rights reserved.
+ *
+ */
+
+#include "heuristic_optimisaion/lower_bound.hpp"
+
+// Adds the two cheapest edges of vertex 0 to a spanning tree of the others.
+static void connect_special_vertex(const int& number_of_vertices,
+                                   const std::vector<std::vector<float>>& cost_matrix,
+                                   const std::vector<double>& penalties,
+                                   double& one_tree_cost,
+                                   std::vector<int>& degrees)
+{
+    double first_cost = DBL_MAX;
+    double second_cost = DBL_MAX;
+    int first_vertex = -1;
+    int second_vertex = -1;
+    for (int j = 1; j < number_of_vertices; ++j)
+    {
+        double edge_cost = cost_matrix[0][j] + penalties[0] + penalties[j];
+        if (edge_cost < first_cost)
+        {
+            second_cost = first_cost;
+            second_vertex = first_vertex;
+            first_cost = edge_cost;
+            first_vertex = j;
+        }
+        else if (edge_cost < second_cost)
+        {
+            second_cost = edge_cost;
+            second_vertex = j;
+        }
+    }
+    one_tree_cost += first_cost + second_cost;
+    degrees[0] = 2;
+    ++degrees[first_vertex];
+    ++degrees[second_vertex];
+}
+
+void compute_one_tree(const int& number_of_vertices,
+                      const std::vector<std::vector<int>>& adjacency,
+                      const std::vector<std::vector<float>>& cost_matrix,
+                      const std::vector<double>& penalties,
+                      double& one_tree_cost,
+                      std::vector<int>& degrees)
+{
+    // Prim's algorithm with a binary heap and lazy deletion on the vertices
+    // other than the special vertex 0.
+    typedef std::pair<double, std::pair<int, int>> HeapEntry;
+    std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<HeapEntry>> heap;
+    std::vector<bool> is_in_tree = std::vector<bool>(number_of_vertices, false);
+    degrees = std::vector<int>(number_of_vertices, 0);
+    one_tree_cost = 0;
+
+    heap.push(std::make_pair(0.0, std::make_pair(-1, 1)));
+    while (!heap.empty())
+    {
+        HeapEntry entry = heap.top();
+        heap.pop();
+        int parent = entry.second.first;
+        int vertex = entry.second.second;
+        if (is_in_tree[vertex])
+        {
+            continue;
+        }
+        is_in_tree[vertex] = true;
+        if (parent != -1)
+        {
+            one_tree_cost += entry.first;
+            ++degrees[parent];
+            ++degrees[vertex];
+        }
+        for (size_t i = 0; i < adjacency[vertex].size(); ++i)
+        {
+            int next_vertex = adjacency[vertex][i];
+            if (next_vertex != 0 && !is_in_tree[next_vertex])
+            {
+                double edge_cost = cost_matrix[vertex][next_vertex] + penalties[vertex] + penalties[next_vertex];
+                heap.push(std::make_pair(edge_cost, std::make_pair(vertex, next_vertex)));
+            }
+        }
+    }
+    connect_special_vertex(number_of_vertices, cost_matrix, penalties, one_tree_cost, degrees);
+}
+
+// Prim's algorithm on the complete graph without the special vertex 0, which
+// takes O(N^2) time but no memory beyond the cost matrix.
+static void compute_dense_spanning_tree(const int& number_of_vertices,
+                                        const std::vector<std::vector<float>>& cost_matrix,
+                                        const std::vector<double>& penalties,
+                                        double& tree_cost,
+                                        std::vector<int>& parents)
+{
+    std::vector<bool> is_in_tree = std::vector<bool>(number_of_vertices, false);
+    std::vector<double> min_costs = std::vector<double>(number_of_vertices, DBL_MAX);
+    parents = std::vector<int>(number_of_vertices, -1);
+    tree_cost = 0;
+
+    min_costs[1] = 0;
+    for (int step = 1; step < number_of_vertices; ++step)
+    {
+        int vertex = -1;
+        for (int i = 1; i < number_of_vertices; ++i)
+        {
+            if (!is_in_tree[i] && (vertex == -1 || min_costs[i] < min_costs[vertex]))
+            {
+                vertex = i;
+            }
+        }
+        is_in_tree[vertex] = true;
+        tree_cost += min_costs[vertex];
+        for (int i = 1; i < number_of_vertices; ++i)
+        {
+            if (!is_in_tree[i])
+            {
+                double edge_cost = cost_matrix[vertex][i] + penalties[vertex] + penalties[i];
+                if (edge_cost < min_costs[i])
+                {
+                    min_costs[i] = edge_cost;
+                    parents[i] = vertex;
+                }
+            }
+        }
+    }
+}
+
+void compute_dense_one_tree(const int& number_of_vertices,
+                            const std::vector<std::vector<float>>& cost_matrix,
+                            const std::vector<double>& penalties,
+                            double& one_tree_cost,
+                            std::vector<int>& degrees)
+{
+    std::vector<int> parents;
+    compute_dense_spanning_tree(number_of_vertices, cost_matrix, penalties, one_tree_cost, parents);
+    degrees = std::vector<int>(number_of_vertices, 0);
+    for (int i = 1; i < number_of_vertices; ++i)
+    {
+        if (parents[i] != -1)
+        {
+            ++degrees[parents[i]];
+            ++degrees[i];
+        }
+    }
+    connect_special_vertex(number_of_vertices, cost_matrix, penalties, one_tree_cost, degrees);
+}
+
+void compute_lower_bound(const int& number_of_vertices,
+                         const int& number_of_candidates,
+                         const int& number_of_iterations,
+                         const float& upper_bound,
+                         const std::vector<std::vector<float>>& cost_matrix,
+                         float& lower_bound)
+{
+    lower_bound = 0;
+    if (number_of_vertices < 3)
+    {
+        return;
+    }
+
+    // The candidate graph is made symmetric, and the edges of the minimum
+    // spanning tree are added to it so that it is always connected.
+    std::vector<std::vector<int>> candidates;
+    compute_candidates(number_of_vertices, number_of_candidates, cost_matrix, candidates);
+    std::vector<std::vector<int>> adjacency = candidates;
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        for (size_t j = 0; j < candidates[i].size(); ++j)
+        {
+            adjacency[candidates[i][j]].push_back(i);
+        }
+    }
+    std::vector<double> penalties = std::vector<double>(number_of_vertices, 0);
+    double one_tree_cost;
+    std::vector<int> parents;
+    compute_dense_spanning_tree(number_of_vertices, cost_matrix, penalties, one_tree_cost, parents);
+    for (int i = 1; i < number_of_vertices; ++i)
+    {
+        if (parents[i] != -1)
+        {
+            adjacency[i].push_back(parents[i]);
+            adjacency[parents[i]].push_back(i);
+        }
+    }
+    std::vector<double> best_penalties = penalties;
+    double best_bound = -DBL_MAX;
+    std::vector<int> degrees;
+
+    // Subgradient ascent with Polyak steps towards the upper bound. The step
+    // scale is halved whenever the bound stops improving.
+    double step_scale = 2.0;
+    int stall_count = 0;
+    for (int iteration = 0; iteration < number_of_iterations; ++iteration)
+    {
+        double penalty_sum = 0;
+        for (int i = 0; i < number_of_vertices; ++i)
+        {
+            penalty_sum += penalties[i];
+        }
+        compute_one_tree(number_of_vertices, adjacency, cost_matrix, penalties, one_tree_cost, degrees);
+        double bound = one_tree_cost - 2 * penalty_sum;
+        if (bound > best_bound)
+        {
+            best_bound = bound;
+            best_penalties = penalties;
+            stall_count = 0;
+        }
+        else if (++stall_count >= 10)
+        {
+            step_scale /= 2;
+            stall_count = 0;
+        }
+
+        double norm = 0;
+        for (int i = 0; i < number_of_vertices; ++i)
+        {
+            norm += (degrees[i] - 2) * (degrees[i] - 2);
+        }
+        if (norm == 0 || upper_bound <= bound)
+        {
+            break;
+        }
+        double step = step_scale * (upper_bound - bound) / norm;
+        for (int i = 0; i < number_of_vertices; ++i)
+        {
+            penalties[i] += step * (degrees[i] - 2);
+        }
+    }
+
+    double penalty_sum = 0;
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        penalty_sum += best_penalties[i];
+    }
+    compute_dense_one_tree(number_of_vertices, cost_matrix, best_penalties, one_tree_cost, degrees);
+    lower_bound = static_cast<float>(one_tree_cost - 2 * penalty_sum);
+}
@@ -0,0 +1,90 @@
+/**
+ * @file sparse_algorithm.cpp
+ * @author Nguyen Quang <nqoptik@gmail.com>
+ * @brief The greedy and ant algorithms on a sparse graph.
+ * @since 0.0.2
+ *
+ * @copyright Copyright (c) 2016, Nguyen Quang, all rights reserved.
+ *
+ */
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include <opencv2/core/core.hpp>
+#include <opencv2/highgui/highgui.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
+
+#include "heuristic_optimisaion/checkpoint.hpp"
+#include "heuristic_optimisaion/common.hpp"
+#include "heuristic_optimisaion/hilbert_curve.hpp"
+#include "heuristic_optimisaion/sparse_graph.hpp"
+
+int main()
+{
+    int height = 800;
+    int width = 1200;
+    int step_size = 2;
+    int border = 25;
+    int number_of_vertices = 5000;
+    std::vector<std::vector<int>> vertices;
+    generate_vertices("vertices.data", height, width, step_size, border,
+                      number_of_vertices, vertices);
+    bool renumber = true;
+    std::vector<int> original_ids;
+    if (renumber)
+    {
+        renumber_vertices(vertices, original_ids);
+    }
+
+    // A road network would be read by load_sparse_graph(). Here the graph of
+    // the nearest neighbours of the generated vertices stands in for it.
+    int number_of_neighbours = 8;
+    SparseGraph graph;
+    build_nearest_neighbour_graph(vertices, number_of_neighbours, graph);
+
+    std::vector<int> greedy_tour;
+    float greedy_cost;
+    sparse_greedy(graph, 0, greedy_tour, greedy_cost);
+    std::cout << "greedy  " << greedy_cost << std::endl;
+
+    int number_of_ants = 100 * number_of_vertices;
+    float evaporation = 0.8;
+    std::vector<int> ant_tour;
+    float ant_cost;
+    sparse_ant(graph, number_of_ants, evaporation, ant_tour, ant_cost);
+    std::cout << "ant  " << ant_cost << std::endl;
+    if (ant_cost == FLT_MAX || static_cast<int>(ant_tour.size()) != number_of_vertices)
+    {
+        std::cerr << "No tour through all vertices, the graph is not connected" << std::endl;
+        return 1;
+    }
+    std::vector<int> output_tour = ant_tour;
+    restore_tour(original_ids, output_tour);
+    save_tour("sparse_tour.data", output_tour);
+
+    cv::Mat sparse_map(height, width, CV_8UC3, cv::Scalar(255, 255, 255));
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        cv::line(sparse_map,
+                 cv::Point(vertices[ant_tour[i]][0], vertices[ant_tour[i]][1]),
+                 cv::Point(vertices[ant_tour[(i + 1) % number_of_vertices]][0],
+                           vertices[ant_tour[(i + 1) % number_of_vertices]][1]),
+                 cv::Scalar(255, 0, 0), 1, 8, 0);
+    }
+    std::string sparse_text = "number_of_vertices = ";
+    sparse_text.append(std::to_string(number_of_vertices));
+    sparse_text.append("     greedy: ");
+    sparse_text.append(std::to_string(greedy_cost));
+    sparse_text.append("     ant: ");
+    sparse_text.append(std::to_string(ant_cost));
+    cv::putText(sparse_map, sparse_text, cv::Point(border, height - border),
+                cv::FONT_HERSHEY_COMPLEX, 1, cv::Scalar(255, 0, 0), 2, 8);
+    cv::imshow("Sparse", sparse_map);
+    cv::imwrite("sparse.png", sparse_map);
+    cv::waitKey();
+
+    return 0;
+}
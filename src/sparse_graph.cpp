@@ -0,0 +1,533 @@
+/**
+ * @file sparse_graph.cpp
+ * @author Nguyen Quang <nqoptik@gmail.com>
+ * @brief Sparse graphs in compressed sparse row form and the solvers on them.
+ * @since 0.0.2
+ *
+ * @copyright Copyright (c) 2016, Nguyen Quang, all rights reserved.
+ *
+ */
+
+#include "heuristic_optimisaion/sparse_graph.hpp"
+
+// Distances of a Dijkstra search. Only the touched entries are reset between
+// searches, so that a search costs time in the part of the graph it explores.
+struct ShortestPathSearch
+{
+    std::vector<float> distances;
+    std::vector<int> touched;
+};
+
+static void initialise_search(const int& number_of_vertices,
+                              ShortestPathSearch& search)
+{
+    search.distances = std::vector<float>(number_of_vertices, FLT_MAX);
+    search.touched.clear();
+}
+
+// Returns the nearest vertex from source, by shortest path, for which
+// is_target() holds, or -1 if there is none in reach.
+template <typename IsTarget>
+static int search_nearest(const SparseGraph& graph,
+                          const int& source,
+                          const IsTarget& is_target,
+                          ShortestPathSearch& search,
+                          float& cost)
+{
+    typedef std::pair<float, int> HeapEntry;
+    std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<HeapEntry>> heap;
+    search.distances[source] = 0;
+    search.touched.push_back(source);
+    heap.push(std::make_pair(0.0f, source));
+
+    int nearest_vertex = -1;
+    while (!heap.empty())
+    {
+        HeapEntry entry = heap.top();
+        heap.pop();
+        int vertex = entry.second;
+        if (entry.first > search.distances[vertex])
+        {
+            continue;
+        }
+        if (vertex != source && is_target(vertex))
+        {
+            nearest_vertex = vertex;
+            cost = entry.first;
+            break;
+        }
+        for (int e = graph.offsets[vertex]; e < graph.offsets[vertex + 1]; ++e)
+        {
+            int next_vertex = graph.neighbours[e];
+            float distance = entry.first + graph.weights[e];
+            if (distance < search.distances[next_vertex])
+            {
+                if (search.distances[next_vertex] == FLT_MAX)
+                {
+                    search.touched.push_back(next_vertex);
+                }
+                search.distances[next_vertex] = distance;
+                heap.push(std::make_pair(distance, next_vertex));
+            }
+        }
+    }
+
+    for (size_t i = 0; i < search.touched.size(); ++i)
+    {
+        search.distances[search.touched[i]] = FLT_MAX;
+    }
+    search.touched.clear();
+    return nearest_vertex;
+}
+
+static int find_edge(const SparseGraph& graph,
+                     const int& from,
+                     const int& to)
+{
+    std::vector<int>::const_iterator first = graph.neighbours.begin() + graph.offsets[from];
+    std::vector<int>::const_iterator last = graph.neighbours.begin() + graph.offsets[from + 1];
+    std::vector<int>::const_iterator edge = std::lower_bound(first, last, to);
+    if (edge == last || *edge != to)
+    {
+        return -1;
+    }
+    return static_cast<int>(edge - graph.neighbours.begin());
+}
+
+static float pair_cost(const SparseGraph& graph,
+                       const int& from,
+                       const int& to,
+                       ShortestPathSearch& search)
+{
+    int edge = find_edge(graph, from, to);
+    if (edge != -1)
+    {
+        return graph.weights[edge];
+    }
+    float cost = FLT_MAX;
+    search_nearest(graph, from, [&](const int& vertex)
+                   { return vertex == to; },
+                   search, cost);
+    return cost;
+}
+
+void build_sparse_graph(const int& number_of_vertices,
+                        const std::vector<int>& sources,
+                        const std::vector<int>& targets,
+                        const std::vector<float>& edge_weights,
+                        SparseGraph& graph)
+{
+    int number_of_edges = static_cast<int>(sources.size());
+    std::vector<int> degrees = std::vector<int>(number_of_vertices, 0);
+    for (int i = 0; i < number_of_edges; ++i)
+    {
+        if (sources[i] != targets[i])
+        {
+            ++degrees[sources[i]];
+            ++degrees[targets[i]];
+        }
+    }
+
+    std::vector<int> offsets = std::vector<int>(number_of_vertices + 1, 0);
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        offsets[i + 1] = offsets[i] + degrees[i];
+    }
+    std::vector<std::pair<int, float>> entries = std::vector<std::pair<int, float>>(offsets[number_of_vertices]);
+    std::vector<int> positions(offsets.begin(), offsets.end() - 1);
+    for (int i = 0; i < number_of_edges; ++i)
+    {
+        if (sources[i] != targets[i])
+        {
+            entries[positions[sources[i]]++] = std::make_pair(targets[i], edge_weights[i]);
+            entries[positions[targets[i]]++] = std::make_pair(sources[i], edge_weights[i]);
+        }
+    }
+
+    // The rows are sorted by neighbour so that edges are found by binary
+    // search, and parallel edges are merged into the cheapest one.
+    graph.number_of_vertices = number_of_vertices;
+    graph.offsets = std::vector<int>(number_of_vertices + 1, 0);
+    graph.neighbours.clear();
+    graph.weights.clear();
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        std::sort(entries.begin() + offsets[i], entries.begin() + offsets[i + 1]);
+        for (int e = offsets[i]; e < offsets[i + 1]; ++e)
+        {
+            if (e == offsets[i] || entries[e].first != entries[e - 1].first)
+            {
+                graph.neighbours.push_back(entries[e].first);
+                graph.weights.push_back(entries[e].second);
+            }
+        }
+        graph.offsets[i + 1] = static_cast<int>(graph.neighbours.size());
+    }
+}
+
+bool load_sparse_graph(const std::string& file_name,
+                       SparseGraph& graph)
+{
+    std::ifstream fs;
+    fs.open(file_name.c_str());
+    int number_of_vertices = 0;
+    int number_of_edges = 0;
+    if (!(fs >> number_of_vertices >> number_of_edges) || number_of_vertices <= 0 || number_of_edges < 0)
+    {
+        return false;
+    }
+
+    std::vector<int> sources = std::vector<int>(number_of_edges);
+    std::vector<int> targets = std::vector<int>(number_of_edges);
+    std::vector<float> edge_weights = std::vector<float>(number_of_edges);
+    for (int i = 0; i < number_of_edges; ++i)
+    {
+        if (!(fs >> sources[i] >> targets[i] >> edge_weights[i]) ||
+            sources[i] < 0 || sources[i] >= number_of_vertices ||
+            targets[i] < 0 || targets[i] >= number_of_vertices || edge_weights[i] < 0)
+        {
+            return false;
+        }
+    }
+    build_sparse_graph(number_of_vertices, sources, targets, edge_weights, graph);
+    return true;
+}
+
+void build_nearest_neighbour_graph(const std::vector<std::vector<int>>& vertices,
+                                   const int& number_of_neighbours,
+                                   SparseGraph& graph)
+{
+    int number_of_vertices = static_cast<int>(vertices.size());
+    if (number_of_vertices == 0)
+    {
+        build_sparse_graph(0, std::vector<int>(), std::vector<int>(), std::vector<float>(), graph);
+        return;
+    }
+
+    // The vertices are bucketed in a uniform grid with about two vertices per
+    // cell, and each search visits rings of cells around its vertex until no
+    // closer neighbour can be found.
+    int min_x = vertices[0][0];
+    int max_x = vertices[0][0];
+    int min_y = vertices[0][1];
+    int max_y = vertices[0][1];
+    for (int i = 1; i < number_of_vertices; ++i)
+    {
+        min_x = std::min(min_x, vertices[i][0]);
+        max_x = std::max(max_x, vertices[i][0]);
+        min_y = std::min(min_y, vertices[i][1]);
+        max_y = std::max(max_y, vertices[i][1]);
+    }
+    double area = static_cast<double>(max_x - min_x + 1) * (max_y - min_y + 1);
+    int cell_size = std::max(1, static_cast<int>(sqrt(2 * area / number_of_vertices)));
+    int grid_width = (max_x - min_x) / cell_size + 1;
+    int grid_height = (max_y - min_y) / cell_size + 1;
+
+    std::vector<int> cells = std::vector<int>(number_of_vertices);
+    std::vector<int> cell_offsets = std::vector<int>(grid_width * grid_height + 1, 0);
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        cells[i] = (vertices[i][1] - min_y) / cell_size * grid_width + (vertices[i][0] - min_x) / cell_size;
+        ++cell_offsets[cells[i] + 1];
+    }
+    for (int i = 0; i < grid_width * grid_height; ++i)
+    {
+        cell_offsets[i + 1] += cell_offsets[i];
+    }
+    std::vector<int> cell_vertices = std::vector<int>(number_of_vertices);
+    std::vector<int> positions(cell_offsets.begin(), cell_offsets.end() - 1);
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        cell_vertices[positions[cells[i]]++] = i;
+    }
+
+    int neighbour_count = std::min(number_of_neighbours, number_of_vertices - 1);
+    std::vector<std::vector<int>> nearest_neighbours = std::vector<std::vector<int>>(number_of_vertices);
+    parallel_for(0, number_of_vertices, [&](const int& i)
+    {
+        int cell_x = cells[i] % grid_width;
+        int cell_y = cells[i] / grid_width;
+        std::vector<std::pair<float, int>> found;
+        for (int ring = 0; ring < std::max(grid_width, grid_height); ++ring)
+        {
+            for (int y = cell_y - ring; y <= cell_y + ring; ++y)
+            {
+                for (int x = cell_x - ring; x <= cell_x + ring; ++x)
+                {
+                    bool is_on_ring = y == cell_y - ring || y == cell_y + ring ||
+                                      x == cell_x - ring || x == cell_x + ring;
+                    if (!is_on_ring || x < 0 || y < 0 || x >= grid_width || y >= grid_height)
+                    {
+                        continue;
+                    }
+                    int cell = y * grid_width + x;
+                    for (int j = cell_offsets[cell]; j < cell_offsets[cell + 1]; ++j)
+                    {
+                        if (cell_vertices[j] != i)
+                        {
+                            found.push_back(std::make_pair(compute_cost(vertices[i], vertices[cell_vertices[j]]),
+                                                           cell_vertices[j]));
+                        }
+                    }
+                }
+            }
+            if (static_cast<int>(found.size()) >= neighbour_count)
+            {
+                std::partial_sort(found.begin(), found.begin() + neighbour_count, found.end());
+                found.resize(neighbour_count);
+                if (neighbour_count == 0 || found.back().first <= ring * cell_size)
+                {
+                    break;
+                }
+            }
+        }
+        for (size_t j = 0; j < found.size(); ++j)
+        {
+            nearest_neighbours[i].push_back(found[j].second);
+        }
+    });
+
+    std::vector<int> sources;
+    std::vector<int> targets;
+    std::vector<float> edge_weights;
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        for (size_t j = 0; j < nearest_neighbours[i].size(); ++j)
+        {
+            sources.push_back(i);
+            targets.push_back(nearest_neighbours[i][j]);
+            edge_weights.push_back(compute_cost(vertices[i], vertices[nearest_neighbours[i][j]]));
+        }
+    }
+    build_sparse_graph(number_of_vertices, sources, targets, edge_weights, graph);
+}
+
+float shortest_path_cost(const SparseGraph& graph,
+                         const int& from,
+                         const int& to)
+{
+    if (from == to)
+    {
+        return 0;
+    }
+    ShortestPathSearch search;
+    initialise_search(graph.number_of_vertices, search);
+    float cost = FLT_MAX;
+    search_nearest(graph, from, [&](const int& vertex)
+                   { return vertex == to; },
+                   search, cost);
+    return cost;
+}
+
+float sparse_tour_cost(const SparseGraph& graph,
+                       const std::vector<int>& tour)
+{
+    int tour_size = static_cast<int>(tour.size());
+    if (tour_size < 2)
+    {
+        return 0;
+    }
+    ShortestPathSearch search;
+    initialise_search(graph.number_of_vertices, search);
+    float cost = 0;
+    for (int i = 0; i < tour_size; ++i)
+    {
+        cost += pair_cost(graph, tour[i], tour[(i + 1) % tour_size], search);
+    }
+    return cost;
+}
+
+void sparse_greedy(const SparseGraph& graph,
+                   const int& start,
+                   std::vector<int>& tour,
+                   float& cost)
+{
+    int number_of_vertices = graph.number_of_vertices;
+    std::vector<bool> has_been_visited = std::vector<bool>(number_of_vertices, false);
+    ShortestPathSearch search;
+    initialise_search(number_of_vertices, search);
+    tour = std::vector<int>(number_of_vertices);
+    tour[0] = start;
+    has_been_visited[start] = true;
+    int current_vertex = start;
+    cost = 0;
+    for (int step = 1; step < number_of_vertices; ++step)
+    {
+        float min_cost = FLT_MAX;
+        int nearest_vertex = -1;
+        for (int e = graph.offsets[current_vertex]; e < graph.offsets[current_vertex + 1]; ++e)
+        {
+            if (min_cost > graph.weights[e] && has_been_visited[graph.neighbours[e]] == false)
+            {
+                min_cost = graph.weights[e];
+                nearest_vertex = graph.neighbours[e];
+            }
+        }
+
+        // Once all neighbours are visited, the tour moves along the shortest
+        // path to the nearest unvisited vertex.
+        if (nearest_vertex == -1)
+        {
+            nearest_vertex = search_nearest(graph, current_vertex, [&](const int& vertex)
+                                            { return has_been_visited[vertex] == false; },
+                                            search, min_cost);
+        }
+        if (nearest_vertex == -1)
+        {
+            std::cerr << "The graph is not connected" << std::endl;
+            cost = FLT_MAX;
+            return;
+        }
+        tour[step] = nearest_vertex;
+        has_been_visited[nearest_vertex] = true;
+        current_vertex = nearest_vertex;
+        cost += min_cost;
+    }
+    cost += pair_cost(graph, tour[number_of_vertices - 1], start, search);
+}
+
+void sparse_ant(const SparseGraph& graph,
+                const int& number_of_ants,
+                const float& evaporation,
+                std::vector<int>& tour,
+                float& cost)
+{
+    int number_of_vertices = graph.number_of_vertices;
+    int number_of_edges = static_cast<int>(graph.neighbours.size());
+    cost = FLT_MAX;
+    tour.clear();
+    if (number_of_vertices < 2)
+    {
+        tour = std::vector<int>(number_of_vertices, 0);
+        cost = 0;
+        return;
+    }
+
+    // Pheromone and heuristic factors are kept per edge of the graph, and
+    // every edge knows its reverse edge for the symmetric updates.
+    float scale_factor = 1;
+    for (int e = 0; e < number_of_edges; ++e)
+    {
+        scale_factor = std::max(scale_factor, graph.weights[e]);
+    }
+    std::vector<float> pheromone = std::vector<float>(number_of_edges, 1.0f / number_of_vertices);
+    std::vector<float> heuristic_factors = std::vector<float>(number_of_edges);
+    std::vector<int> reverse_edges = std::vector<int>(number_of_edges);
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        for (int e = graph.offsets[i]; e < graph.offsets[i + 1]; ++e)
+        {
+            heuristic_factors[e] = graph.weights[e] == 0 ? scale_factor : scale_factor / graph.weights[e];
+            reverse_edges[e] = find_edge(graph, graph.neighbours[e], i);
+        }
+    }
+
+    ShortestPathSearch search;
+    initialise_search(number_of_vertices, search);
+    std::vector<bool> has_been_visited = std::vector<bool>(number_of_vertices);
+    std::vector<int> path = std::vector<int>(number_of_vertices);
+    std::vector<int> path_edges = std::vector<int>(number_of_vertices);
+    std::vector<int> tour_edges;
+    std::vector<float> probability;
+    int stop_count = 0;
+    for (int ant = 0; ant < number_of_ants; ++ant)
+    {
+        std::fill(has_been_visited.begin(), has_been_visited.end(), false);
+        int start = random_number() % number_of_vertices;
+        path[0] = start;
+        has_been_visited[start] = true;
+        int current_vertex = start;
+        float current_cost = 0;
+
+        for (int step = 1; step < number_of_vertices && current_cost < FLT_MAX; ++step)
+        {
+            int first_edge = graph.offsets[current_vertex];
+            int degree = graph.offsets[current_vertex + 1] - first_edge;
+            probability.assign(degree, 0);
+            float sum_probability = 0;
+            for (int i = 0; i < degree; ++i)
+            {
+                if (has_been_visited[graph.neighbours[first_edge + i]] == false)
+                {
+                    sum_probability += pheromone[first_edge + i] * heuristic_factors[first_edge + i];
+                }
+                probability[i] = sum_probability;
+            }
+
+            int selected_edge = -1;
+            int selected_vertex = -1;
+            if (sum_probability > 0)
+            {
+                float roulette = static_cast<float>(random_number()) / static_cast<float>(RAND_MAX) * sum_probability;
+                int i = static_cast<int>(std::upper_bound(probability.begin(), probability.end(), roulette) -
+                                         probability.begin());
+                selected_edge = first_edge + std::min(i, degree - 1);
+                while (has_been_visited[graph.neighbours[selected_edge]])
+                {
+                    --selected_edge;
+                }
+                selected_vertex = graph.neighbours[selected_edge];
+                current_cost += graph.weights[selected_edge];
+            }
+            else
+            {
+                float jump_cost = FLT_MAX;
+                selected_vertex = search_nearest(graph, current_vertex, [&](const int& vertex)
+                                                 { return has_been_visited[vertex] == false; },
+                                                 search, jump_cost);
+                current_cost = selected_vertex == -1 ? FLT_MAX : current_cost + jump_cost;
+            }
+            if (selected_vertex == -1)
+            {
+                break;
+            }
+
+            path[step] = selected_vertex;
+            path_edges[step - 1] = selected_edge;
+            has_been_visited[selected_vertex] = true;
+            current_vertex = selected_vertex;
+        }
+        if (current_cost == FLT_MAX)
+        {
+            std::cerr << "The graph is not connected" << std::endl;
+            return;
+        }
+        path_edges[number_of_vertices - 1] = find_edge(graph, current_vertex, start);
+        current_cost += pair_cost(graph, current_vertex, start, search);
+
+        if (current_cost < cost)
+        {
+            cost = current_cost;
+            tour = path;
+            tour_edges = path_edges;
+            stop_count = 0;
+        }
+        else
+        {
+            ++stop_count;
+        }
+
+        // As in the dense ant algorithm, every hundredth deposit reinforces the
+        // best tour instead of the tour of the ant.
+        const std::vector<int>& deposit_edges = ant % 100 == 99 ? tour_edges : path_edges;
+        float delta = scale_factor / (ant % 100 == 99 ? cost : current_cost);
+        for (int i = 0; i < number_of_vertices; ++i)
+        {
+            int edge = deposit_edges[i];
+            if (edge != -1)
+            {
+                pheromone[edge] += delta;
+                pheromone[reverse_edges[edge]] += delta;
+            }
+        }
+        for (int e = 0; e < number_of_edges; ++e)
+        {
+            pheromone[e] = evaporation * pheromone[e];
+        }
+
+        if (stop_count > 10000 * number_of_vertices)
+        {
+            break;
+        }
+    }
+}